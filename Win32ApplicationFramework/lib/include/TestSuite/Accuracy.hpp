@@ -0,0 +1,196 @@
+/*!
+lib\include\TestSuite\Accuracy.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Accuracy header file.
+
+\note
+An accuracy case compares a function against a reference implementation (usually the <cmath> one) over millions of inputs. The inputs
+are spread evenly over the ordered bit patterns between the lower and upper bound, so every binade in the range gets a similar share of
+samples, and the sweep is split across threads. Errors are measured in units in the last place (ULP) of the reference result and
+collected into a histogram together with the worst inputs. Both functions are then timed on the calling thread, giving ns/call for each.
+The reference is itself correctly rounded only to within about half an ULP, so small errors are relative to the reference, not to the
+exact result.
+*/
+
+#pragma once
+
+#ifndef ACCURACY_HPP_
+#define ACCURACY_HPP_
+
+#include "TestSuite.hpp"
+#include "Benchmark.hpp"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <limits>
+
+namespace winxframe
+{
+	namespace accuracy
+	{
+		/* Pass as maxUlp to report the error without failing the case */
+		inline constexpr double unbounded = std::numeric_limits<double>::infinity();
+
+		/* Returns the distance between value and reference in ULPs of the reference, infinity when exactly one of them is NaN or infinite */
+		template <std::floating_point T>
+		double UlpError(T value, T reference) noexcept
+		{
+			if (std::isnan(value) || std::isnan(reference))
+				return std::isnan(value) && std::isnan(reference) ? 0.0 : std::numeric_limits<double>::infinity();
+			if (value == reference)
+				return 0.0;
+			if (std::isinf(value) || std::isinf(reference))
+				return std::numeric_limits<double>::infinity();
+
+			const T magnitude = std::abs(reference);
+			T spacing = std::nextafter(magnitude, std::numeric_limits<T>::infinity()) - magnitude;
+			if (std::isinf(spacing))
+				spacing = magnitude - std::nextafter(magnitude, T{});
+			return static_cast<double>(std::abs(static_cast<long double>(value) - static_cast<long double>(reference)) / static_cast<long double>(spacing));
+		}
+	}; // end of namespace accuracy
+
+	struct AccuracyWorst
+	{
+		double input = 0.0;
+		double ulp = 0.0;
+		long double value = 0.0L;
+		long double reference = 0.0L;
+	};
+
+	struct AccuracyStats
+	{
+		// ULP error histogram buckets: 0, 1, 2, 3-4, 5-16, 17-256, above 256 (including NaN or infinity mismatches)
+		static constexpr std::array<double, 6> bucketLimits = { 0.0, 1.0, 2.0, 4.0, 16.0, 256.0 };
+		static constexpr std::size_t worstCount = 3;
+
+		std::uint64_t samples = 0;
+		std::array<std::uint64_t, bucketLimits.size() + 1> buckets{};
+		double maxUlp = 0.0;
+		double sumUlp = 0.0;						// finite errors only, so one mismatch does not hide the mean
+		std::uint64_t mismatches = 0;				// NaN or infinity where the reference has neither, or the other way around
+		std::vector<AccuracyWorst> worst;			// largest errors first
+		double nsPerCall = 0.0;
+		double referenceNsPerCall = 0.0;
+
+		double MeanUlp() const noexcept { return samples > mismatches ? sumUlp / static_cast<double>(samples - mismatches) : 0.0; }
+		void Record(double input, double ulp, long double value, long double reference);
+		void Merge(const AccuracyStats& other);
+	};
+
+	class AccuracyCase : public TestRegistry::TestCase
+	{
+	private:
+		double low_;
+		double high_;
+		double maxUlp_;
+		std::uint64_t sampleCount_ = 1ULL << 22;
+		AccuracyStats stats_{};
+
+	protected:
+		static constexpr std::size_t timingInputCount = 4096;
+
+		/**
+		* @brief	Evaluate the function and the reference at the inputs with indices [first, last). Generated by DifferentialCase.
+		* @param	AccuracyStats& stats : Statistics of the calling thread.
+		*/
+		virtual void Sweep(std::uint64_t first, std::uint64_t last, AccuracyStats& stats) const = 0;
+
+		/**
+		* @brief	Measure the nanoseconds per call of the function or the reference. Generated by DifferentialCase.
+		*/
+		virtual double TimeCalls(bool isReference) const = 0;
+
+		/**
+		* @brief	Returns the input with the given index, the bit patterns between low and high are divided evenly among sampleCount inputs.
+		*/
+		double Input(std::uint64_t index, std::uint64_t count) const noexcept;
+
+		/**
+		* @brief	Runs a batch of timingInputCount calls per repetition, doubling the repetitions until a batch is long enough to time,
+		*			and returns the fastest of several batches in nanoseconds per call.
+		* @param	const std::function<void(std::uint64_t)>& batch : Calls the function timingInputCount times for every repetition.
+		*/
+		static double NsPerCall(const std::function<void(std::uint64_t)>& batch);
+
+	public:
+		/**
+		* @brief	Register an accuracy case.
+		* @param	double low		: Lowest input.
+		* @param	double high		: Highest input.
+		* @param	double maxUlp	: Largest ULP error that passes, accuracy::unbounded only reports the error.
+		*/
+		AccuracyCase(const std::string& name, double low, double high, double maxUlp, const std::string& group, const std::string& section);
+		AccuracyCase(const std::string& name, double low, double high, double maxUlp, const std::string& group) : AccuracyCase(name, low, high, maxUlp, group, "default") {}
+		virtual ~AccuracyCase() = default;
+
+		/**
+		* @brief	Sweep every input across all hardware threads, time both functions, and check the largest error against maxUlp.
+		*/
+		virtual void Run() override final;
+
+		void SetSampleCount(std::uint64_t sampleCount) noexcept { sampleCount_ = std::clamp<std::uint64_t>(sampleCount, 1, 1ULL << 32); }
+		std::uint64_t GetSampleCount() const noexcept { return sampleCount_; }
+		double GetMaxUlp() const noexcept { return maxUlp_; }
+		const AccuracyStats& GetStats() const noexcept { return stats_; }
+	};
+
+	/*
+	* Implements the sweep and the timing loops for one floating type. Case provides static Function(T) and Reference(T), so both are
+	* called directly and can be inlined into the loops, see ACCURACY_CASE in test_macros.hpp.
+	*/
+	template <std::floating_point T, typename Case>
+	class DifferentialCase : public AccuracyCase
+	{
+	protected:
+		virtual void Sweep(std::uint64_t first, std::uint64_t last, AccuracyStats& stats) const override
+		{
+			const std::uint64_t count = this->GetSampleCount();
+			for (std::uint64_t i = first; i < last; ++i)
+			{
+				const T x = static_cast<T>(this->Input(i, count));
+				const T value = Case::Function(x);
+				const T reference = Case::Reference(x);
+				stats.Record(static_cast<double>(x), accuracy::UlpError(value, reference), value, reference);
+			}
+		}
+
+		virtual double TimeCalls(bool isReference) const override
+		{
+			std::vector<T> inputs(timingInputCount);
+			for (std::size_t i = 0; i < inputs.size(); ++i)
+				inputs[i] = static_cast<T>(this->Input(i, inputs.size()));
+
+			if (isReference)
+			{
+				return AccuracyCase::NsPerCall([&inputs](std::uint64_t repetitions)
+					{
+						T sum{};
+						for (std::uint64_t r = 0; r < repetitions; ++r)
+							for (const T x : inputs)
+								sum += Case::Reference(x);
+						benchmark::DoNotOptimize(sum);
+					}
+				);
+			}
+			return AccuracyCase::NsPerCall([&inputs](std::uint64_t repetitions)
+				{
+					T sum{};
+					for (std::uint64_t r = 0; r < repetitions; ++r)
+						for (const T x : inputs)
+							sum += Case::Function(x);
+					benchmark::DoNotOptimize(sum);
+				}
+			);
+		}
+
+	public:
+		using AccuracyCase::AccuracyCase;
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,119 @@
+/*!
+lib\include\TestSuite\Benchmark.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Benchmark header file.
+
+\note
+A benchmark case runs its body in timed batches: warmup passes first, then the iteration count per batch is calibrated so that one
+batch fills a fixed slice of the time budget, and finally a set of batches is sampled. Every sample is reduced to a per-iteration time
+so that robust statistics (median, median absolute deviation, percentiles) can be reported instead of a single noisy measurement.
+*/
+
+#pragma once
+
+#ifndef BENCHMARK_HPP_
+#define BENCHMARK_HPP_
+
+#include "TestSuite.hpp"
+#include <atomic>
+#include <cstdint>
+
+namespace winxframe
+{
+	namespace benchmark
+	{
+		void UseCharPointer(char const volatile* pointer) noexcept;
+
+		/* Forces the compiler to materialize value (in a register or memory), preventing the computation that produced it from being optimized away */
+		template <typename T>
+		inline void DoNotOptimize(T const& value) noexcept
+		{
+			UseCharPointer(&reinterpret_cast<char const volatile&>(value));
+			std::atomic_signal_fence(std::memory_order_acq_rel);
+		}
+
+		/* Acts as a compiler read/write barrier, forcing all pending memory writes to be treated as observable */
+		inline void ClobberMemory() noexcept
+		{
+			std::atomic_signal_fence(std::memory_order_acq_rel);
+		}
+	}; // end of namespace benchmark
+
+	struct BenchmarkStats
+	{
+		std::uint64_t iterations = 0;	// iterations per sample
+		std::uint64_t samples = 0;		// number of timed samples
+		double median = 0.0;			// nanoseconds per iteration
+		double mad = 0.0;				// median absolute deviation, nanoseconds per iteration
+		double min = 0.0;
+		double p90 = 0.0;
+		double p99 = 0.0;
+		double mean = 0.0;
+		double stddev = 0.0;
+		PerfCounterValues counters{};	// hardware counter totals over all timed samples
+	};
+
+	struct BaselineComparison
+	{
+		bool hasBaseline = false;	// false when the case has no entry in the baseline file
+		double change = 0.0;		// relative change of the median, (current - baseline) / baseline
+		double pValue = 1.0;		// one-sided Welch's t-test p-value for "current is slower than baseline"
+		bool isRegressed = false;	// change above threshold AND statistically significant
+	};
+
+	class BenchmarkCase : public TestRegistry::TestCase
+	{
+	private:
+		std::chrono::nanoseconds warmupTime_ = std::chrono::milliseconds(10);
+		std::chrono::nanoseconds targetTime_ = std::chrono::milliseconds(50);
+		std::uint64_t sampleCount_ = 100;
+		BenchmarkStats stats_{};
+		BaselineComparison comparison_{};
+
+		std::chrono::nanoseconds TimeBatch(std::uint64_t iterations, PerfCounterValues* counters = nullptr);
+		std::uint64_t Calibrate(std::chrono::nanoseconds sampleTime);
+
+	protected:
+		/**
+		* @brief	Execute the benchmark body the given number of times. Generated by the BENCHMARK_CASE macro so the body can be inlined into the loop.
+		* @param	std::uint64_t iterations : Number of times to execute the body.
+		*/
+		virtual void RunBatch(std::uint64_t iterations) = 0;
+
+	public:
+		BenchmarkCase(const std::string& name, const std::string& group, const std::string& section) : TestCase(name, group, section) {}
+		BenchmarkCase(const std::string& name, const std::string& group) : TestCase(name, group) {}
+		BenchmarkCase(const std::string& name) : TestCase(name) {}
+		virtual ~BenchmarkCase() = default;
+
+		/**
+		* @brief	Warm up, calibrate, and sample the benchmark body, then reduce the samples to BenchmarkStats.
+		*/
+		virtual void Run() override final;
+
+		/**
+		* @brief	Set the time spent on warmup passes and the total time budget for the timed samples.
+		* @param	std::chrono::nanoseconds warmupTime : Time spent executing the body before calibration.
+		* @param	std::chrono::nanoseconds targetTime : Time budget shared by all timed samples.
+		*/
+		void SetTimeBudget(std::chrono::nanoseconds warmupTime, std::chrono::nanoseconds targetTime) noexcept { warmupTime_ = warmupTime; targetTime_ = targetTime; }
+
+		const BenchmarkStats& GetStats() const noexcept { return stats_; }
+		const BaselineComparison& GetComparison() const noexcept { return comparison_; }
+		void SetComparison(const BaselineComparison& comparison) noexcept { comparison_ = comparison; }
+		bool IsRegressed() const noexcept { return comparison_.isRegressed; }
+
+		/**
+		* @brief	Reduce per-iteration samples (in nanoseconds) to median, MAD, min, p90, p99, mean, and standard deviation.
+		* @param	std::vector<double> samples : Per-iteration times, taken by value since they are sorted in place.
+		* @param	std::uint64_t iterations	: Iterations per sample, stored with the result.
+		* @return	BenchmarkStats
+		*/
+		static BenchmarkStats ComputeStats(std::vector<double> samples, std::uint64_t iterations);
+	};
+}; // end of namespace winxframe
+
+#endif
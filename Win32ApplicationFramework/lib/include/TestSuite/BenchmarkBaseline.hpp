@@ -0,0 +1,69 @@
+/*!
+lib\include\TestSuite\BenchmarkBaseline.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Benchmark Baseline header file.
+
+\note
+The baseline file is plain text, one benchmark case per line: group, section, and case name followed by the sample count, median, MAD,
+mean, and standard deviation (nanoseconds per iteration), all separated by tabs. Lines starting with '#' are ignored.
+*/
+
+#pragma once
+
+#ifndef BENCHMARKBASELINE_HPP_
+#define BENCHMARKBASELINE_HPP_
+
+#include "Benchmark.hpp"
+#include <filesystem>
+#include <map>
+
+namespace winxframe
+{
+	class BenchmarkBaseline
+	{
+	private:
+		std::map<std::string, BenchmarkStats> entries_;
+
+		static std::string MakeKey(const std::string& group, const std::string& section, const std::string& name);
+
+	public:
+		/**
+		* @brief	Load baseline entries from a file, replacing any entries already held.
+		* @param	const std::filesystem::path& path : Baseline file to read.
+		* @return	TRUE if the file was opened, FALSE if it does not exist or cannot be read.
+		*/
+		bool Load(const std::filesystem::path& path);
+
+		/**
+		* @brief	Write every held entry to a file, sorted by key.
+		* @param	const std::filesystem::path& path : Baseline file to write.
+		* @return	TRUE on success, FALSE if the file could not be written.
+		*/
+		bool Save(const std::filesystem::path& path) const;
+
+		/**
+		* @brief	Return the baseline entry for a benchmark case, or nullptr if there is none.
+		*/
+		const BenchmarkStats* Find(const BenchmarkCase& benchmarkCase) const;
+
+		/**
+		* @brief	Insert or replace the baseline entry for a benchmark case with its latest stats.
+		*/
+		void Update(const BenchmarkCase& benchmarkCase);
+
+		/**
+		* @brief	Compare current stats against a baseline using the relative median change and a one-sided Welch's t-test.
+		* @param	const BenchmarkStats& baseline	: Stats loaded from the baseline file.
+		* @param	const BenchmarkStats& current	: Stats from this run.
+		* @param	double threshold				: Minimum relative slowdown of the median to count as a regression, e.g. 0.10 for 10%.
+		* @param	double significance				: Maximum p-value to count as a regression.
+		* @return	BaselineComparison
+		*/
+		static BaselineComparison Compare(const BenchmarkStats& baseline, const BenchmarkStats& current, double threshold, double significance) noexcept;
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,70 @@
+/*!
+lib\include\TestSuite\ChildProcess.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Child Process header file.
+
+\note
+Launches another instance of the current executable with an anonymous pipe it can report back on. The write end of the pipe is the only
+handle the child inherits, and its value is appended to the command line as --test-child-pipe=<handle>. Everything the child writes is
+collected by a reader thread so that a chatty child can never block on a full pipe while the parent waits on it.
+*/
+
+#pragma once
+
+#ifndef CHILDPROCESS_HPP_
+#define CHILDPROCESS_HPP_
+
+#include <win32/framework.h>
+
+namespace winxframe
+{
+	class ChildProcess
+	{
+	private:
+		HANDLE process_ = nullptr;
+		HANDLE readPipe_ = nullptr;
+		std::thread reader_;
+		std::string output_;
+
+		void Close() noexcept;
+
+	public:
+		ChildProcess(ChildProcess const&) = delete;
+		void operator = (ChildProcess const&) = delete;
+
+		/**
+		* @brief	Launch the current executable with the given arguments and a pipe to report on.
+		* @param	const std::wstring& arguments : Command line arguments passed to the child, excluding the program name.
+		* @throws	Error if the pipe or the process could not be created.
+		*/
+		explicit ChildProcess(const std::wstring& arguments);
+		~ChildProcess();
+
+		/**
+		* @brief	Wait for the child to exit, terminating it once the timeout elapses.
+		* @param	std::chrono::milliseconds timeout : Wall clock limit for the child.
+		* @return	TRUE if the child exited on its own, FALSE if it was terminated.
+		*/
+		bool Wait(std::chrono::milliseconds timeout);
+
+		/**
+		* @brief	Return the exit code of the child. For a crashed child this is the unhandled exception code, e.g. 0xC0000005.
+		*/
+		DWORD GetExitCode() const noexcept;
+
+		/**
+		* @brief	Return everything the child wrote to its pipe. Only valid after Wait() has returned.
+		*/
+		const std::string& GetOutput() const noexcept { return output_; }
+
+		/**
+		* @brief	Return the name of an exit code that is an exception or status code (e.g. "EXCEPTION_ACCESS_VIOLATION"), or an empty string.
+		*/
+		static std::string ExitCodeName(DWORD exitCode);
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,106 @@
+/*!
+lib\include\TestSuite\ParameterizedCase.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Parameterized Case header file.
+
+\note
+Support for TEST_CASE_TEMPLATE and TEST_CASE_VALUES (see test_macros.hpp). Every instantiation is an ordinary registered TestCase with
+its own report row, named after its parameter, e.g. "ut_math_20<long long>" or "ut_math_22[3]=(7.5)", so instantiations are filtered,
+sharded, isolated, and scheduled in parallel like any other case. Type names are taken from the spelling in the macro invocation.
+*/
+
+#pragma once
+
+#ifndef PARAMETERIZEDCASE_HPP_
+#define PARAMETERIZEDCASE_HPP_
+
+#include "TestSuite.hpp"
+#include <concepts>
+#include <memory>
+#include <typeinfo>
+#include <utility>
+
+namespace winxframe
+{
+	namespace test_params
+	{
+		/* Splits a stringized template argument list such as "int, std::pair<int, int>" at its top level commas, trimming whitespace */
+		std::vector<std::string> SplitTypeNames(std::string_view typeNames);
+
+		/* Returns the case name of one type instantiation, falling back to the compiler's type name if the spelling did not split into typeCount names */
+		std::string TypeCaseName(const std::string& name, const std::vector<std::string>& typeNames, std::size_t typeCount, std::size_t index, const char* typeidName);
+
+		template <typename T>
+		concept streamable = requires(std::ostream & os, const T & value) { os << value; };
+
+		/* Returns the case name of one value instantiation, including the value when it can be streamed */
+		template <typename T>
+		std::string ValueCaseName(const std::string& name, std::size_t index, const T& value)
+		{
+			std::ostringstream oss;
+			oss << name << '[' << index << ']';
+			if constexpr (streamable<T>)
+				oss << "=(" << value << ')';
+			return oss.str();
+		}
+
+		/* Returns first, first + step, ... up to and including last */
+		template <typename T>
+		std::vector<T> Range(T first, T last, T step = T{ 1 })
+		{
+			std::vector<T> values;
+			for (T value = first; step > T{} ? value <= last : value >= last; value += step)
+				values.push_back(value);
+			return values;
+		}
+
+		/* Returns generator(0), generator(1), ... generator(count - 1) */
+		template <typename Generator>
+		auto Generate(std::size_t count, Generator generator) -> std::vector<std::decay_t<decltype(generator(std::size_t{}))>>
+		{
+			std::vector<std::decay_t<decltype(generator(std::size_t{}))>> values;
+			values.reserve(count);
+			for (std::size_t i = 0; i < count; ++i)
+				values.push_back(generator(i));
+			return values;
+		}
+	}; // end of namespace test_params
+
+	/*
+	* Holds one statically constructed case per type. Each Case<T> is a distinct base class, so every instantiation registers itself
+	* exactly like a TEST_CASE object does, without a heap allocation.
+	*/
+	template <template <typename> class Case, typename... Types>
+	class TemplateCaseList : private Case<Types>...
+	{
+	private:
+		template <std::size_t... Indices>
+		TemplateCaseList(const std::string& name, const std::vector<std::string>& typeNames, std::index_sequence<Indices...>) :
+			Case<Types>(test_params::TypeCaseName(name, typeNames, sizeof...(Types), Indices, typeid(Types).name()))... {}
+
+	public:
+		TemplateCaseList(const std::string& name, std::string_view typeNames) :
+			TemplateCaseList(name, test_params::SplitTypeNames(typeNames), std::index_sequence_for<Types...>{}) {}
+	};
+
+	/* Holds one case per value, the number of values is only known once the value expression has been evaluated */
+	template <typename Case, typename Value>
+	class ValueCaseList
+	{
+	private:
+		std::vector<std::unique_ptr<Case>> cases_;
+
+	public:
+		ValueCaseList(const std::string& name, const std::vector<Value>& values)
+		{
+			cases_.reserve(values.size());
+			for (std::size_t i = 0; i < values.size(); ++i)
+				cases_.push_back(std::make_unique<Case>(test_params::ValueCaseName(name, i, values[i]), values[i]));
+		}
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,66 @@
+/*!
+lib\include\TestSuite\ReportBuffer.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Report Buffer header file.
+
+\note
+Renders a whole report into one preallocated buffer and writes it to standard output with a single call. Colors are inserted as ANSI/VT
+escape sequences (see ConsoleColor.hpp), so the output is the same on the Windows console and on ANSI terminals. Virtual terminal
+processing is enabled on the console the first time a ReportBuffer is created; when it cannot be enabled, or standard output is
+redirected, colors are dropped rather than written as raw escape sequences.
+*/
+
+#pragma once
+
+#ifndef REPORTBUFFER_HPP_
+#define REPORTBUFFER_HPP_
+
+#include <ostream>
+#include <streambuf>
+#include <string>
+
+namespace winxframe
+{
+	class ReportBuffer : public std::ostream
+	{
+	private:
+		class StringBuffer : public std::streambuf
+		{
+		private:
+			std::string buffer_;
+
+		protected:
+			int_type overflow(int_type ch) override;
+			std::streamsize xsputn(const char_type* s, std::streamsize count) override;
+
+		public:
+			std::string& Get() noexcept { return buffer_; }
+		};
+
+		StringBuffer buffer_;
+
+		static bool EnableVirtualTerminal() noexcept;
+
+	public:
+		ReportBuffer(ReportBuffer const&) = delete;
+		void operator = (ReportBuffer const&) = delete;
+
+		/**
+		* @brief	Create an empty report with room for the given number of characters.
+		* @param	std::size_t capacity : Characters to preallocate, the buffer still grows past it if needed.
+		*/
+		explicit ReportBuffer(std::size_t capacity);
+
+		/**
+		* @brief	Write the buffered report to standard output with a single call and empty the buffer.
+		*/
+		void Flush();
+
+		const std::string& GetText() noexcept { return buffer_.Get(); }
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,71 @@
+/*!
+lib\include\TestSuite\Stress.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Stress header file.
+
+\note
+A stress case runs its body concurrently on several threads to exercise shared state under contention. Every thread waits on a start
+barrier so they all enter the body together, and each thread records its checks into its own sink case, merged into the stress case
+once the threads have joined. The body is run at doubling thread counts (1, 2, 4, ... up to the requested count) so the report shows how
+throughput scales, making contention cliffs visible rather than only checking correctness.
+*/
+
+#pragma once
+
+#ifndef STRESS_HPP_
+#define STRESS_HPP_
+
+#include "TestSuite.hpp"
+#include <cstdint>
+
+namespace winxframe
+{
+	struct StressLevel
+	{
+		std::size_t threads = 0;			// threads running the body concurrently
+		std::uint64_t operations = 0;		// body executions summed over all threads
+		std::chrono::nanoseconds elapsed{};	// wall time from the barrier release until the last thread finished
+
+		double OpsPerSecond() const noexcept { return elapsed.count() > 0 ? static_cast<double>(operations) * 1e9 / static_cast<double>(elapsed.count()) : 0.0; }
+	};
+
+	class StressCase : public TestRegistry::TestCase
+	{
+	private:
+		std::size_t threadCount_;
+		std::uint64_t iterations_;
+		std::vector<StressLevel> levels_;
+
+		StressLevel RunLevel(std::size_t threads);
+
+	protected:
+		/**
+		* @brief	Execute the stress body the given number of times on the calling thread. Generated by the TEST_CASE_STRESS macro.
+		* @param	std::size_t threadIndex		: Index of the calling thread within the current level, from 0.
+		* @param	std::uint64_t iterations	: Number of times to execute the body.
+		*/
+		virtual void RunThread(std::size_t threadIndex, std::uint64_t iterations) = 0;
+
+	public:
+		/**
+		* @brief	Register a stress case.
+		* @param	std::size_t threadCount		: Highest number of concurrent threads, 0 uses std::thread::hardware_concurrency().
+		* @param	std::uint64_t iterations	: Body executions per thread at every level.
+		*/
+		StressCase(const std::string& name, std::size_t threadCount, std::uint64_t iterations, const std::string& group, const std::string& section);
+		StressCase(const std::string& name, std::size_t threadCount, std::uint64_t iterations, const std::string& group) : StressCase(name, threadCount, iterations, group, "default") {}
+		virtual ~StressCase() = default;
+
+		/**
+		* @brief	Run the body at every thread count level and merge the checks of every thread into this case.
+		*/
+		virtual void Run() override final;
+
+		const std::vector<StressLevel>& GetLevels() const noexcept { return levels_; }
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,63 @@
+/*!
+lib\include\TestSuite\TestFilter.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test Filter header file.
+
+\note
+A filter is a comma separated list of patterns. Patterns are wildcard globs ('*' and '?') unless prefixed with "re:", in which case the
+remainder is an ECMAScript regular expression that must match the whole name. A leading '-' turns a pattern into an exclusion.
+A name passes the filter when it matches at least one inclusion pattern (or there are none) and no exclusion pattern.
+
+Example: "Math*,-*Benchmarks" selects every group starting with "Math" except the benchmark groups.
+*/
+
+#pragma once
+
+#ifndef TESTFILTER_HPP_
+#define TESTFILTER_HPP_
+
+#include <optional>
+#include <regex>
+#include <string>
+#include <vector>
+
+namespace winxframe
+{
+	class TestFilter
+	{
+	private:
+		struct Pattern
+		{
+			std::string glob;
+			std::optional<std::regex> regex;
+			bool isExclusion = false;
+		};
+
+		std::vector<Pattern> patterns_;
+		bool hasInclusion_ = false;
+
+	public:
+		TestFilter() = default;
+
+		/**
+		* @brief	Parse a comma separated list of glob, regex ("re:"), and exclusion ('-') patterns.
+		* @param	const std::string& filter : Filter expression, an empty string matches everything.
+		* @throws	std::invalid_argument if a regex pattern does not compile.
+		*/
+		explicit TestFilter(const std::string& filter);
+
+		/**
+		* @brief	Test a group, section, or case name against the filter.
+		* @param	const std::string& name : Name to test.
+		* @return	TRUE if the name is selected by the filter.
+		*/
+		bool Matches(const std::string& name) const;
+
+		bool IsEmpty() const noexcept { return patterns_.empty(); }
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,73 @@
+/*!
+lib\include\TestSuite\TestHistory.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test History header file.
+
+\note
+The history file is plain text, one test case per line: group, section, and case name followed by the last elapsed time in nanoseconds and
+the last outcome (1 failed, 0 passed), all separated by tabs. Lines starting with '#' are ignored. Entries of cases that did not run keep
+their previous values, so filtered and sharded runs do not forget the rest of the suite.
+*/
+
+#pragma once
+
+#ifndef TESTHISTORY_HPP_
+#define TESTHISTORY_HPP_
+
+#include "TestSuite.hpp"
+#include <filesystem>
+#include <map>
+
+namespace winxframe
+{
+	struct TestHistoryEntry
+	{
+		std::chrono::nanoseconds elapsed{};	// elapsed time of the last run
+		bool isFailed = false;				// outcome of the last run
+	};
+
+	class TestHistory
+	{
+	private:
+		std::map<std::string, TestHistoryEntry> entries_;
+
+		static std::string MakeKey(const TestRegistry::TestCase& testCase);
+
+	public:
+		/**
+		* @brief	Load history entries from a file, replacing any entries already held.
+		* @param	const std::filesystem::path& path : History file to read.
+		* @return	TRUE if the file was opened, FALSE if it does not exist or cannot be read.
+		*/
+		bool Load(const std::filesystem::path& path);
+
+		/**
+		* @brief	Write every held entry to a file, sorted by key.
+		* @param	const std::filesystem::path& path : History file to write.
+		* @return	TRUE on success, FALSE if the file could not be written.
+		*/
+		bool Save(const std::filesystem::path& path) const;
+
+		/**
+		* @brief	Return the history entry for a test case, or nullptr if there is none.
+		*/
+		const TestHistoryEntry* Find(const TestRegistry::TestCase& testCase) const;
+
+		/**
+		* @brief	Insert or replace the history entry for a test case with its latest elapsed time and outcome.
+		*/
+		void Update(const TestRegistry::TestCase& testCase, bool isFailed);
+
+		/**
+		* @brief	Order test cases for execution: cases that failed last time first, then cases without history, then the rest longest first.
+		*			Running the longest cases first keeps a parallel run from ending on one long straggler.
+		* @param	std::vector<TestRegistry::TestCase*>& testCases : Cases to reorder in place. Ties keep their relative order.
+		*/
+		void Schedule(std::vector<TestRegistry::TestCase*>& testCases) const;
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,128 @@
+/*!
+lib\include\TestSuite\TestMetrics.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test Metrics header file.
+
+\note
+Allocation counts come from the replacement global operator new/delete in AllocationHooks.cpp. The hooks only count while an
+AllocationScope is open on the calling thread, so untracked code pays a single thread_local test per allocation. Memory is attributed to
+the thread that allocates or frees it: a block allocated outside a scope and freed inside one lowers the live byte count of that scope.
+In Debug builds, 'new' expressions in translation units that include debug.h go through the CRT debug operator new and are not counted;
+standard containers and allocators always go through the replaceable operator new and are.
+
+Hardware counters are read per thread. Windows has no user-mode equivalent of perf_event_open: cycles come from QueryThreadCycleTime(),
+while retired instructions and branch/cache misses need a kernel driver or an ETW PMC session. An application that has one installs it with
+PerfCounters::SetSource(); without a source those counters are reported as unavailable (blank), and IPC with them.
+*/
+
+#pragma once
+
+#ifndef TESTMETRICS_HPP_
+#define TESTMETRICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+
+namespace winxframe
+{
+	struct AllocationStats
+	{
+		std::uint64_t allocations = 0;		// calls to operator new
+		std::uint64_t deallocations = 0;	// calls to operator delete with a non-null pointer
+		std::uint64_t bytesAllocated = 0;	// total bytes requested from operator new
+		std::uint64_t peakLiveBytes = 0;	// high water mark of bytes allocated and not yet freed, relative to the start of the scope
+	};
+
+	struct PerfCounterValues
+	{
+		std::optional<std::uint64_t> cycles;		// CPU cycles charged to the thread
+		std::optional<std::uint64_t> instructions;	// retired instructions
+		std::optional<std::uint64_t> branchMisses;	// mispredicted branches
+		std::optional<std::uint64_t> l1dMisses;		// level 1 data cache misses
+		std::optional<std::uint64_t> llcMisses;		// last level cache misses
+
+		/* Adds every counter available in other, counters that are unavailable stay empty */
+		PerfCounterValues& operator += (const PerfCounterValues& other) noexcept;
+	};
+
+	/* Fills the counters it can read for the calling thread and leaves the others empty, called at the start and stop of every measurement */
+	using PerfCounterSource = void (*)(PerfCounterValues& values) noexcept;
+
+	class PerfCounters
+	{
+	private:
+		PerfCounterValues start_{};
+
+		static PerfCounterValues Read() noexcept;
+
+	public:
+		/**
+		* @brief	Install the source of the counters besides cycles, shared by every thread. Set it before the test run starts.
+		* @param	PerfCounterSource source	: Counter source, nullptr leaves instructions, branch misses, and cache misses unavailable.
+		*/
+		static void SetSource(PerfCounterSource source) noexcept;
+
+		/**
+		* @brief	Snapshot the counters of the calling thread.
+		*/
+		void Start() noexcept { start_ = PerfCounters::Read(); }
+
+		/**
+		* @brief	Return the counter deltas of the calling thread since Start(). Must be called on the thread that called Start().
+		* @return	PerfCounterValues, with unavailable counters left empty.
+		*/
+		PerfCounterValues Stop() const noexcept;
+	};
+
+	struct CaseMetrics
+	{
+		bool isMeasured = false;				// false when the case ran without instrumentation
+		AllocationStats allocationStats{};
+		std::chrono::nanoseconds cpuTime{};		// user + kernel time of the thread that ran the case, at scheduler tick granularity
+		std::uint64_t peakWorkingSet = 0;		// process peak working set (peak RSS) in bytes when the case finished
+		PerfCounterValues counters{};
+	};
+
+	class AllocationScope
+	{
+	private:
+		std::uint64_t startAllocations_;
+		std::uint64_t startDeallocations_;
+		std::uint64_t startBytesAllocated_;
+		std::int64_t startLiveBytes_;
+		std::int64_t outerPeakLiveBytes_;
+		AllocationStats stats_{};
+		bool isStopped_ = false;
+
+	public:
+		AllocationScope(AllocationScope const&) = delete;
+		void operator = (AllocationScope const&) = delete;
+
+		/**
+		* @brief	Start counting allocations made by the calling thread. Scopes may be nested.
+		*/
+		AllocationScope() noexcept;
+		~AllocationScope();
+
+		/**
+		* @brief	Stop counting and return the allocations made since the scope started. Further calls return the same result.
+		* @return	AllocationStats
+		*/
+		AllocationStats Stop() noexcept;
+	};
+
+	namespace metrics
+	{
+		/* Returns the user + kernel time consumed by the calling thread */
+		std::chrono::nanoseconds ThreadCpuTime() noexcept;
+
+		/* Returns the peak working set (peak resident set) of the process in bytes */
+		std::uint64_t PeakWorkingSet() noexcept;
+	}; // end of namespace metrics
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,94 @@
+/*!
+lib\include\TestSuite\TestOptions.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test Options header file.
+
+\note
+Selection and sharding can be set from the environment (WINXFRAME_TEST_GROUP, WINXFRAME_TEST_SECTION, WINXFRAME_TEST_CASE,
+WINXFRAME_TEST_SHARD_INDEX, WINXFRAME_TEST_SHARD_COUNT, WINXFRAME_TEST_PARALLEL, WINXFRAME_TEST_JOBS, WINXFRAME_TEST_ISOLATE,
+WINXFRAME_TEST_TIMEOUT, WINXFRAME_TEST_INSTRUMENT, WINXFRAME_TEST_HISTORY, WINXFRAME_TEST_BASELINE, WINXFRAME_TEST_UPDATE_BASELINE,
+WINXFRAME_TEST_FAIL_FAST, WINXFRAME_TEST_TRACE, WINXFRAME_TEST_ACCURACY_SAMPLES, WINXFRAME_TEST_BENCHMARKS, WINXFRAME_TEST_STRESS,
+WINXFRAME_TEST_ACCURACY) or from the command line (--test-group=, --test-section=, --test-case=, --test-shard=i/n, --test-jobs=,
+--test-parallel, --test-serial, --test-isolate, --test-timeout=ms, --test-instrument, --test-history=path, --test-baseline=path,
+--test-update-baseline, --test-fail-fast, --test-trace=path, --test-accuracy-samples=, --test-benchmarks, --test-stress, --test-accuracy).
+Command line arguments take precedence over the environment. See TestFilter.hpp for the filter syntax.
+
+Test cases run serially by default. --test-parallel or WINXFRAME_TEST_PARALLEL opts into the WorkStealingPool, and setting the job count
+(--test-jobs= or WINXFRAME_TEST_JOBS) opts in as well; --test-serial turns it back off.
+
+The history and benchmark baseline files are off by default and only read and written once their paths are set.
+
+By default only unit test cases run. Benchmark, stress, and accuracy cases take seconds and are opt-in, the filters select among them once
+their kind is enabled.
+*/
+
+#pragma once
+
+#ifndef TESTOPTIONS_HPP_
+#define TESTOPTIONS_HPP_
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace winxframe
+{
+	struct TestOptions
+	{
+		bool parallel = false;	// schedule test cases onto a work-stealing thread pool
+		std::size_t jobs = 0;	// number of worker threads when parallel, 0 uses std::thread::hardware_concurrency(), setting it also sets parallel
+		std::chrono::milliseconds benchmarkWarmup{ 10 };	// time each benchmark case spends on warmup passes
+		std::chrono::milliseconds benchmarkTime{ 50 };		// time budget shared by the timed samples of each benchmark case
+		std::filesystem::path baselinePath;	// benchmark baseline file, an empty path disables baseline comparison
+		bool updateBaseline = false;			// overwrite existing baseline entries with this run's results
+		double regressionThreshold = 0.10;		// minimum relative slowdown of the median flagged as a regression
+		double regressionSignificance = 0.01;	// maximum p-value of the one-sided Welch's t-test flagged as a regression
+		std::string groupFilter;		// group name filter, empty selects every group
+		std::string sectionFilter;		// section name filter, empty selects every section
+		std::string caseFilter;			// case name filter, empty selects every case
+		std::size_t shardIndex = 0;		// zero based shard run by this process
+		std::size_t shardCount = 1;		// number of disjoint shards the selected cases are dealt into
+		bool isolated = false;									// run each unit test case in its own child process
+		std::chrono::milliseconds caseTimeout{ 30000 };			// wall clock limit of an isolated case before its child process is terminated
+		bool instrument = false;								// count allocations and measure CPU time and peak working set per unit test case
+		std::filesystem::path historyPath;						// per-case durations and outcomes used to schedule the next run, an empty path disables it
+		bool failFast = false;									// stop starting new cases once a case has failed
+		std::filesystem::path tracePath;						// Chrome trace-event JSON file written during the run, an empty path disables tracing
+		std::uint64_t accuracySamples = 1ULL << 22;				// inputs swept by each accuracy case
+		bool runBenchmarks = false;								// run the benchmark cases after the unit tests
+		bool runStress = false;									// run the stress cases after the unit tests
+		bool runAccuracy = false;								// run the accuracy cases after the unit tests
+		std::optional<std::size_t> childCaseIndex;				// set by the parent process, index of the case a child process runs
+		std::uintptr_t childPipe = 0;							// set by the parent process, inherited pipe handle a child process reports to
+
+		bool IsChildProcess() const noexcept { return childCaseIndex.has_value(); }
+
+		/**
+		* @brief	Read selection, sharding, and job options from WINXFRAME_TEST_* environment variables.
+		* @throws	std::invalid_argument if a value is malformed or the shard index is out of range.
+		*/
+		void ApplyEnvironment();
+
+		/**
+		* @brief	Read selection, sharding, and job options from --test-* arguments. Unrecognized arguments are ignored.
+		* @param	const std::vector<std::string>& arguments : Command line arguments, excluding the program name.
+		* @throws	std::invalid_argument if a value is malformed or the shard index is out of range.
+		*/
+		void ApplyArguments(const std::vector<std::string>& arguments);
+
+		/**
+		* @brief	Apply the arguments of the current process command line (GetCommandLineW()).
+		* @throws	std::invalid_argument if a value is malformed or the shard index is out of range.
+		*/
+		void ApplyCommandLine();
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -1,7 +1,7 @@
 /*!
 lib\include\TestSuite\TestSuite.hpp
 Created: October 21, 2025
-Updated: November 15, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Test Suite header file.
@@ -16,24 +16,50 @@ Testing structure and utilization is based on how testing is handled with Boost,
 #define TESTSUITE_HPP_
 
 #include <win32/framework.h>
+#include "TestOptions.hpp"
+#include "TestMetrics.hpp"
+#include "TraceWriter.hpp"
+#include <deque>
 
 namespace winxframe
 {
+	class BenchmarkCase;
+	class StressCase;
+	class AccuracyCase;
+	class TestHistory;
+
 	class TestRegistry
 	{
+	private:
+		class CaseTable;
+
 	public:
 		class TestCase
 		{
 		private:
+			friend class CaseTable;
+
 			std::string caseName_;
 			std::string groupName_;
 			std::string sectionName_;
+			std::uint32_t groupId_ = 0;
+			std::uint32_t sectionId_ = 0;
 			std::uintmax_t testsChecked_ = 0;
 			std::uintmax_t testsPassed_ = 0;
 			double caseWeight_ = 1.0;
-			const std::string defaultGroupName_ = "default";
-			const std::string defaultSectionName_ = "default";
+			static constexpr const char* defaultGroupName_ = "default";
+			static constexpr const char* defaultSectionName_ = "default";
 			std::chrono::nanoseconds caseElapsed_{};
+			std::string failureLog_;
+			CaseMetrics metrics_{};
+
+			void AppendFailure(const std::string& message) noexcept;
+
+		protected:
+			struct Unregistered {};
+
+			/* Constructs a case that is not added to the registry, e.g. the per-thread check sinks of a StressCase */
+			TestCase(Unregistered, const std::string& name, const std::string& group, const std::string& section);
 
 		public:
 			TestCase(TestCase const&) = delete;
@@ -52,43 +78,94 @@ namespace winxframe
 			void CheckEqual(const LHS& lhs, const RHS& rhs, const char* lhsString, const char* rhsString, const char* const file, int line);
 			template <typename LHS, typename RHS, typename Value>
 			void CheckWithin(const LHS& lhs, const RHS& rhs, const Value& min, const char* lhsString, const char* rhsString, const char* minString, const char* const file, int line);
-			void LogCheckFail(const char* const conditionString, const char* const file, int line) const noexcept;
-			void LogCheckFail(const std::string& message, const char* const file, int line) const noexcept;
+			void CheckAllocations(const AllocationStats& stats, std::uint64_t maximum, const char* const codeString, const char* const file, int line);
+			void LogCheckFail(const char* const conditionString, const char* const file, int line) noexcept;
+			void LogCheckFail(const std::string& message, const char* const file, int line) noexcept;
+			void LogCaseFail(const std::string& reason) noexcept;
 			template <typename LHS, typename RHS>
-			void LogCheckEqualFail(const LHS& lhs, const RHS& rhs, const char* lhsString, const char* rhsString, const char* const file, int line) const noexcept;
+			void LogCheckEqualFail(const LHS& lhs, const RHS& rhs, const char* lhsString, const char* rhsString, const char* const file, int line) noexcept;
 			template <typename LHS, typename RHS, typename Value>
-			void LogCheckWithinFail(const LHS& lhs, const RHS& rhs, const Value& min, const char* lhsString, const char* rhsString, const char* minString, const char* const file, int line) const noexcept;
+			void LogCheckWithinFail(const LHS& lhs, const RHS& rhs, const Value& min, const char* lhsString, const char* rhsString, const char* minString, const char* const file, int line) noexcept;
 			virtual void Run() = 0;
 
 			const std::string& GetCaseName() const noexcept { return caseName_; }
 			const std::string& GetGroupName() const noexcept { return groupName_; }
 			const std::string& GetSectionName() const noexcept { return sectionName_; }
+			std::uint32_t GetGroupId() const noexcept { return groupId_; }
+			std::uint32_t GetSectionId() const noexcept { return sectionId_; }
 			std::uintmax_t GetTestsChecked() const noexcept { return testsChecked_; }
 			std::uintmax_t GetTestsPassed() const noexcept { return testsPassed_; }
 			double GetCaseWeight() const noexcept { return caseWeight_; }
 			std::chrono::nanoseconds GetCaseElapsed() const noexcept { return caseElapsed_; }
 			void SetCaseElapsed(std::chrono::nanoseconds elapsed) noexcept { caseElapsed_ = elapsed; }
+			const std::string& GetFailureLog() const noexcept { return failureLog_; }
+			void SetResult(std::uintmax_t testsChecked, std::uintmax_t testsPassed, const std::string& failureLog);
+			const CaseMetrics& GetMetrics() const noexcept { return metrics_; }
+			void SetMetrics(const CaseMetrics& metrics) noexcept { metrics_ = metrics; }
 		};
 
 	private:
-		static std::unique_ptr<std::unordered_map<std::string, std::unordered_map<std::string, std::vector<TestCase*>>>> casesPtr_;
-		static TestCase* currentCasePtr_;
+		/*
+		* Flat registry of every constructed TestCase. Group and section names are interned to integer IDs on registration, and the report
+		* order (groups by name, sections by the name of their first case, cases in registration order) is computed once with integer keys
+		* and cached until another case registers.
+		*/
+		class CaseTable
+		{
+		private:
+			struct Entry
+			{
+				std::uint32_t groupId;
+				std::uint32_t sectionId;
+				std::uint32_t sequence;
+				TestCase* testCase;
+			};
+
+			std::deque<std::string> names_;	// stable storage, so the string_view keys of nameIds_ never dangle
+			std::unordered_map<std::string_view, std::uint32_t> nameIds_;
+			std::vector<Entry> entries_;
+			std::vector<TestCase*> orderedCases_;
+			bool isOrdered_ = false;
+
+		public:
+			std::uint32_t Intern(const std::string& name);
+			void Add(TestCase* testCase);
+			const std::vector<TestCase*>& Ordered();
+			std::size_t Size() const noexcept { return entries_.size(); }
+			std::size_t NameCount() const noexcept { return names_.size(); }
+		};
+
+		static std::unique_ptr<CaseTable> casesPtr_;
+		static thread_local TestCase* currentCasePtr_;
 		static std::ofstream logFile_;
+		TestOptions options_;
 		bool isCleaned_;
 
 		const int Run() const noexcept;
-		static std::unordered_map<std::string, std::unordered_map<std::string, std::vector<TestCase*>>>& CaseMap();
-		const void ReportSummary(std::uintmax_t casesTotal, std::streamsize numMaxGroupName, std::streamsize numMaxSectionName,
-			std::streamsize numMaxCaseName, std::streamsize numMaxTests, std::streamsize numMaxPercent, std::streamsize numMaxWeight,
-			std::streamsize numMaxStatus, std::streamsize numMaxTime) const noexcept;
+		static void RunCase(TestCase* testCase, bool isInstrumented = false) noexcept;
+		static void RunCaseIsolated(TestCase* testCase, std::size_t caseIndex, std::chrono::milliseconds timeout, bool isInstrumented) noexcept;
+		const int RunChild() const noexcept;
+		static CaseTable& Cases();
+		static const std::vector<TestCase*>& OrderedCases();
+		std::vector<TestCase*> SelectCases() const;
+		const void ReportSummary(const std::vector<TestCase*>& testCases, std::chrono::nanoseconds wallElapsed, std::streamsize numMaxGroupName,
+			std::streamsize numMaxSectionName, std::streamsize numMaxCaseName, std::streamsize numMaxTests, std::streamsize numMaxPercent,
+			std::streamsize numMaxWeight, std::streamsize numMaxStatus, std::streamsize numMaxTime) const noexcept;
+		const void ReportBenchmarks(const std::vector<BenchmarkCase*>& benchmarkCases) const noexcept;
+		const void ReportStress(const std::vector<StressCase*>& stressCases) const noexcept;
+		const void ReportAccuracy(const std::vector<AccuracyCase*>& accuracyCases) const noexcept;
+		const void ReportMetrics(const std::vector<TestCase*>& testCases) const noexcept;
+		void CompareBaseline(const std::vector<BenchmarkCase*>& benchmarkCases) const;
+		void UpdateHistory(TestHistory& history, const std::vector<TestCase*>& testCases) const;
 
 		void Cleanup();
 
 	public:
 		friend class TestCase;
-		TestRegistry();
+		friend class StressCase;
+		TestRegistry(const TestOptions& options = TestOptions{});
 		~TestRegistry();
-		static void RunAll();
+		static int RunAll(const TestOptions& options = TestOptions{});
 		static TestCase* CurrentCase();
 		bool IsCleaned() const { return isCleaned_; }
 		void SetCleaned(const bool isCleaned) { isCleaned_ = isCleaned; }
@@ -116,27 +193,23 @@ namespace winxframe
 	}
 
 	template <typename LHS, typename RHS>
-	void TestRegistry::TestCase::LogCheckEqualFail(const LHS& lhs, const RHS& rhs, const char* lhsString, const char* rhsString, const char* const file, int line) const noexcept
+	void TestRegistry::TestCase::LogCheckEqualFail(const LHS& lhs, const RHS& rhs, const char* lhsString, const char* rhsString, const char* const file, int line) noexcept
 	{
 		std::ostringstream oss;
 		std::filesystem::path f = file;
 		oss << "File: " << f.filename().string() << ", Line: " << line << ", check failed in " << this->GetCaseName() << ": "
 			<< "\"" << lhsString << "\" [" << lhs << "] != \"" << rhsString << "\" [" << rhs << "]\n";
-		std::cout << oss.str();
-		if (TestRegistry::logFile_.is_open())
-			TestRegistry::logFile_ << oss.str();
+		this->AppendFailure(oss.str());
 	}
 
 	template <typename LHS, typename RHS, typename Value>
-	void TestRegistry::TestCase::LogCheckWithinFail(const LHS& lhs, const RHS& rhs, const Value& min, const char* lhsString, const char* rhsString, const char* minString, const char* const file, int line) const noexcept
+	void TestRegistry::TestCase::LogCheckWithinFail(const LHS& lhs, const RHS& rhs, const Value& min, const char* lhsString, const char* rhsString, const char* minString, const char* const file, int line) noexcept
 	{
 		std::ostringstream oss;
 		std::filesystem::path f = file;
 		oss << "File: " << f.filename().string() << ", Line: " << line << ", check failed in " << this->GetCaseName() << ": "
 			<< "difference(" << lhsString << ", " << rhsString << ") > " << minString << " ==> \t|" << lhs << " - " << rhs << "| > " << std::abs(min) << '\n';
-		std::cout << oss.str();
-		if (TestRegistry::logFile_.is_open())
-			TestRegistry::logFile_ << oss.str();
+		this->AppendFailure(oss.str());
 	}
 
 }; // end of namespace winxframe
@@ -0,0 +1,114 @@
+/*!
+lib\include\TestSuite\TraceWriter.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Trace Writer header file.
+
+\note
+Writes a Chrome trace-event JSON file (JSON array format) that chrome://tracing and ui.perfetto.dev can open. Every slice is a complete
+("ph":"X") event on the thread that produced it, timestamped in microseconds since the trace was opened. Events are streamed to the file
+as they complete instead of being kept in memory, and the array is left open until the writer is destroyed; both viewers accept a file
+without the closing bracket, so a trace cut short by a crash is still readable. TraceScope costs a single atomic load when no trace is open.
+*/
+
+#pragma once
+
+#ifndef TRACEWRITER_HPP_
+#define TRACEWRITER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+
+namespace winxframe
+{
+	class TraceWriter
+	{
+	public:
+		using time_point = std::chrono::time_point<std::chrono::high_resolution_clock>;
+
+	private:
+		std::ofstream file_;
+		std::mutex mutex_;
+		time_point origin_;
+		bool isFirst_ = true;
+		static std::atomic<TraceWriter*> active_;
+
+		void WriteEvent(const std::string& event);
+
+	public:
+		TraceWriter(TraceWriter const&) = delete;
+		void operator = (TraceWriter const&) = delete;
+
+		/**
+		* @brief	Open a trace file and make it the active trace. Only one trace may be active at a time.
+		* @param	const std::filesystem::path& path : Trace file to create, overwriting an existing file.
+		*/
+		explicit TraceWriter(const std::filesystem::path& path);
+		~TraceWriter();
+
+		bool IsOpen() const noexcept { return file_.is_open(); }
+
+		/**
+		* @brief	Return the active trace, or nullptr when no trace is open.
+		*/
+		static TraceWriter* Active() noexcept { return active_.load(std::memory_order_acquire); }
+
+		/**
+		* @brief	Write a complete slice on the calling thread.
+		* @param	std::string_view name		: Slice name.
+		* @param	std::string_view category	: Slice category, used by the viewers for filtering.
+		* @param	time_point start			: Start of the slice.
+		* @param	time_point stop				: End of the slice.
+		* @param	std::string_view args		: Optional body of the "args" object, already formatted as JSON members.
+		*/
+		void WriteComplete(std::string_view name, std::string_view category, time_point start, time_point stop, std::string_view args = {});
+
+		/**
+		* @brief	Append a "key":"value" member to a JSON args body, escaping both strings.
+		*/
+		static void AppendArg(std::string& args, std::string_view key, std::string_view value);
+
+		/**
+		* @brief	Append a "key":value member to a JSON args body.
+		*/
+		static void AppendArg(std::string& args, std::string_view key, std::uint64_t value);
+	};
+
+	class TraceScope
+	{
+	private:
+		TraceWriter* writer_;
+		std::string name_;
+		std::string_view category_;
+		std::string args_;
+		TraceWriter::time_point start_;
+
+	public:
+		TraceScope(TraceScope const&) = delete;
+		void operator = (TraceScope const&) = delete;
+
+		/**
+		* @brief	Start a slice on the calling thread that ends when the scope is destroyed. Does nothing when no trace is open.
+		* @param	std::string_view name		: Slice name, copied only when a trace is open.
+		* @param	std::string_view category	: Slice category, must outlive the scope.
+		*/
+		TraceScope(std::string_view name, std::string_view category);
+		~TraceScope();
+
+		/**
+		* @brief	Attach an argument to the slice, shown in the viewer's details pane.
+		*/
+		void AddArg(std::string_view key, std::string_view value) { if (writer_) TraceWriter::AppendArg(args_, key, value); }
+		void AddArg(std::string_view key, std::uint64_t value) { if (writer_) TraceWriter::AppendArg(args_, key, value); }
+	};
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,90 @@
+/*!
+lib\include\TestSuite\WorkStealingPool.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Work Stealing Pool header file.
+*/
+
+#pragma once
+
+#ifndef WORKSTEALINGPOOL_HPP_
+#define WORKSTEALINGPOOL_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace winxframe
+{
+	class WorkStealingPool
+	{
+	public:
+		using Task = std::function<void()>;
+
+	private:
+		struct WorkQueue
+		{
+			std::deque<Task> tasks;
+			std::mutex mutex;
+		};
+
+		std::vector<std::unique_ptr<WorkQueue>> queues_;
+		std::vector<std::thread> workers_;
+		std::mutex wakeMutex_;
+		std::condition_variable wakeCondition_;
+		std::condition_variable idleCondition_;
+		std::atomic<std::size_t> queuedTasks_{ 0 };
+		std::atomic<std::size_t> pendingTasks_{ 0 };
+		std::atomic<std::size_t> nextQueue_{ 0 };
+		bool isStopping_ = false;
+
+		static thread_local const WorkStealingPool* ownerPool_;
+		static thread_local std::size_t workerIndex_;
+
+		void WorkerLoop(std::size_t index);
+		bool TryPop(std::size_t index, Task& task);
+		bool TrySteal(std::size_t index, Task& task);
+
+	public:
+		WorkStealingPool(WorkStealingPool const&) = delete;
+		void operator = (WorkStealingPool const&) = delete;
+
+		/**
+		* @brief	Start the worker threads, one local queue per worker.
+		* @param	std::size_t threadCount : Number of workers, 0 selects std::thread::hardware_concurrency().
+		*/
+		explicit WorkStealingPool(std::size_t threadCount = 0);
+
+		/**
+		* @brief	Drain any queued tasks, then stop and join all workers.
+		*/
+		~WorkStealingPool();
+
+		/**
+		* @brief	Queue a task. Tasks submitted from a worker go to that worker's own queue, otherwise queues are filled round-robin.
+		* @param	Task task : Callable to execute on one of the workers.
+		*/
+		void Submit(Task task);
+
+		/**
+		* @brief	Block the calling thread until every submitted task has finished executing.
+		*/
+		void Wait();
+
+		/**
+		* @brief	Return the number of worker threads.
+		* @return	std::size_t workers_.size()
+		*/
+		std::size_t GetThreadCount() const noexcept { return workers_.size(); }
+	};
+}; // end of namespace winxframe
+
+#endif
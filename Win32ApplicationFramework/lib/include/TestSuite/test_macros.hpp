@@ -1,7 +1,7 @@
 /*!
 lib\include\TestSuite\test_macros.hpp
 Created: October 21, 2025
-Updated: November 6, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Test Macros header file.
@@ -13,6 +13,10 @@ Test Macros header file.
 #define TEST_MACROS_HPP_
 
 #include "TestSuite.hpp"
+#include "Benchmark.hpp"
+#include "Stress.hpp"
+#include "ParameterizedCase.hpp"
+#include "Accuracy.hpp"
 
 namespace winxframe
 {
@@ -24,6 +28,22 @@ namespace winxframe
 
 	#define CHECK_WITHIN(testValue, expectedValue, minimum) TestRegistry::CurrentCase()->CheckWithin((testValue), (expectedValue), (minimum), #testValue, #expectedValue, #minimum, __FILE__, __LINE__)
 
+	// Runs the statements and fails the check if they made more than 'maximum' heap allocations on the calling thread, see AllocationScope
+	#define CHECK_MAX_ALLOCS(maximum, ...)\
+		do {\
+			AllocationScope allocationScope_;\
+			{ __VA_ARGS__; }\
+			TestRegistry::CurrentCase()->CheckAllocations(allocationScope_.Stop(), (maximum), #__VA_ARGS__, __FILE__, __LINE__);\
+		} while (false)
+
+	#define CHECK_NO_ALLOC(...) CHECK_MAX_ALLOCS(0, __VA_ARGS__)
+
+	#define TRACE_CONCAT_IMPL(lhs, rhs) lhs##rhs
+	#define TRACE_CONCAT(lhs, rhs) TRACE_CONCAT_IMPL(lhs, rhs)
+
+	// Adds a slice from here to the end of the enclosing block to the trace (--test-trace=), e.g. around the setup of a test case
+	#define TRACE_SCOPE(name) TraceScope TRACE_CONCAT(traceScope_, __LINE__)((name), "scope")
+
 	#define TEST_CASE(name, ...)\
 		static class TestCase_##name : public TestRegistry::TestCase {\
 			public: TestCase_##name() : TestCase(#name, __VA_ARGS__) {}\
@@ -65,6 +85,52 @@ namespace winxframe
 			public: virtual void Run() override;\
 		} TestCase_##name##_g;\
 		void TestCase_##name::Run()
+
+	// TEST_CASE_TEMPLATE(name, group, section, Types...): registers one case per type, the type is TestType inside the body
+	#define TEST_CASE_TEMPLATE(name, group, section, ...)\
+		template <typename TestType> class TemplateCase_##name : public TestRegistry::TestCase {\
+			public: explicit TemplateCase_##name(const std::string& caseName) : TestCase(caseName, group, section) {}\
+			public: virtual void Run() override;\
+		};\
+		static TemplateCaseList<TemplateCase_##name, __VA_ARGS__> TemplateCase_##name##_g(#name, #__VA_ARGS__);\
+		template <typename TestType> void TemplateCase_##name<TestType>::Run()
+
+	// TEST_CASE_VALUES(name, group, section, type, values): registers one case per value, the value is testValue inside the body.
+	// values is a braced list or an expression convertible to std::vector<type>, e.g. test_params::Range() or test_params::Generate()
+	#define TEST_CASE_VALUES(name, group, section, type, ...)\
+		class ValueCase_##name : public TestRegistry::TestCase {\
+			private: type value_;\
+			public: ValueCase_##name(const std::string& caseName, const type& value) : TestCase(caseName, group, section), value_(value) {}\
+			public: virtual void Run() override { this->RunValue(value_); }\
+			private: void RunValue(const type& testValue);\
+		};\
+		static ValueCaseList<ValueCase_##name, type> ValueCase_##name##_g(#name, std::vector<type>(__VA_ARGS__));\
+		void ValueCase_##name::RunValue([[maybe_unused]] const type& testValue)
+
+	#define BENCHMARK_CASE(name, ...)\
+		static class BenchmarkCase_##name : public BenchmarkCase {\
+			public: BenchmarkCase_##name() : BenchmarkCase(#name, __VA_ARGS__) {}\
+			protected: virtual void RunBatch(std::uint64_t iterations) override { for (std::uint64_t i = 0; i < iterations; ++i) this->Iterate(); }\
+			private: void Iterate();\
+		} BenchmarkCase_##name##_g;\
+		void BenchmarkCase_##name::Iterate()
+
+	// ACCURACY_CASE(name, type, function, reference, low, high, maxUlp, group[, section]): function and reference are expressions of x, e.g. Exp(x) and std::exp(x)
+	#define ACCURACY_CASE(name, type, function, reference, low, high, maxUlp, ...)\
+		static class AccuracyCase_##name : public DifferentialCase<type, AccuracyCase_##name> {\
+			public: AccuracyCase_##name() : DifferentialCase(#name, (low), (high), (maxUlp), __VA_ARGS__) {}\
+			public: static type Function(type x) { return static_cast<type>(function); }\
+			public: static type Reference(type x) { return static_cast<type>(reference); }\
+		} AccuracyCase_##name##_g
+
+	// TEST_CASE_STRESS(name, threadCount, iterationCount, group[, section]): the body runs iterationCount times on each thread, threadIndex is in scope
+	#define TEST_CASE_STRESS(name, threadCount, iterationCount, ...)\
+		static class StressCase_##name : public StressCase {\
+			public: StressCase_##name() : StressCase(#name, (threadCount), (iterationCount), __VA_ARGS__) {}\
+			protected: virtual void RunThread(std::size_t threadIndex, std::uint64_t count) override { for (std::uint64_t i = 0; i < count; ++i) this->Iterate(threadIndex); }\
+			private: void Iterate([[maybe_unused]] std::size_t threadIndex);\
+		} StressCase_##name##_g;\
+		void StressCase_##name::Iterate([[maybe_unused]] std::size_t threadIndex)
 }; // end of namespace winxframe
 
 #endif
\ No newline at end of file
@@ -0,0 +1,884 @@
+/*!
+lib\include\utils\big_int.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Big Integer header file.
+
+\note
+Signed integers of any size for exact results past the fixed width types, e.g. Factorial<BigInt>(n) and Fibonacci<BigInt>(n). The
+magnitude is held as 64-bit limbs, least significant first, with no leading zero limbs so that zero has none; the sign is kept apart and
+zero is never negative. Values up to 128 bits live inside the object, larger ones on the heap.
+Multiplication is schoolbook below karatsubaThreshold limbs and Karatsuba above. Division is Knuth's algorithm D below
+burnikelZieglerThreshold limbs and Burnikel-Ziegler above, recursive halving onto Karatsuba products. Decimal conversion splits the value
+at powers 10^(19 * 2^k) so that the large divisions and multiplications act on balanced operands, subquadratic in both directions.
+*/
+
+#pragma once
+
+#ifndef BIG_INT_HPP_
+#define BIG_INT_HPP_
+
+#include "math_utils.hpp"
+#include <algorithm>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <ostream>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace winxframe
+{
+    namespace math_utils
+    {
+        namespace detail
+        {
+            /* Limbs of a BigInt, two limbs (128 bits) are stored inline before anything is allocated */
+            class LimbBuffer
+            {
+            private:
+                static constexpr std::size_t inlineCapacity = 2;
+
+                std::size_t size_ = 0;
+                std::size_t capacity_ = inlineCapacity;
+                union
+                {
+                    std::uint64_t inline_[inlineCapacity];
+                    std::uint64_t* heap_;
+                };
+
+                [[nodiscard]] bool IsInline() const noexcept { return capacity_ == inlineCapacity; }
+
+                void Release() noexcept
+                {
+                    if (!IsInline())
+                        delete[] heap_;
+                }
+
+                /* Takes the limbs of other, which is left empty */
+                void Steal(LimbBuffer& other) noexcept
+                {
+                    size_ = other.size_;
+                    capacity_ = other.capacity_;
+                    if (other.IsInline())
+                        std::copy_n(other.inline_, inlineCapacity, inline_);
+                    else
+                        heap_ = other.heap_;
+                    other.size_ = 0;
+                    other.capacity_ = inlineCapacity;
+                }
+
+            public:
+                LimbBuffer() noexcept : inline_{ 0, 0 } {}
+                LimbBuffer(const LimbBuffer& other) : LimbBuffer() { Assign(other.data(), other.size_); }
+                LimbBuffer(LimbBuffer&& other) noexcept { Steal(other); }
+                ~LimbBuffer() { Release(); }
+
+                LimbBuffer& operator=(const LimbBuffer& other)
+                {
+                    if (this != &other)
+                        Assign(other.data(), other.size_);
+                    return *this;
+                }
+
+                LimbBuffer& operator=(LimbBuffer&& other) noexcept
+                {
+                    if (this != &other)
+                    {
+                        Release();
+                        Steal(other);
+                    }
+                    return *this;
+                }
+
+                [[nodiscard]] std::uint64_t* data() noexcept { return IsInline() ? inline_ : heap_; }
+                [[nodiscard]] const std::uint64_t* data() const noexcept { return IsInline() ? inline_ : heap_; }
+                [[nodiscard]] std::size_t size() const noexcept { return size_; }
+                [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+                [[nodiscard]] std::uint64_t& operator[](std::size_t i) noexcept { return data()[i]; }
+                [[nodiscard]] std::uint64_t operator[](std::size_t i) const noexcept { return data()[i]; }
+                [[nodiscard]] std::uint64_t back() const noexcept { return data()[size_ - 1]; }
+
+                void reserve(std::size_t capacity)
+                {
+                    if (capacity <= capacity_)
+                        return;
+                    capacity = Max(capacity, capacity_ * 2);
+                    std::uint64_t* heap = new std::uint64_t[capacity];
+                    std::copy_n(data(), size_, heap);
+                    Release();
+                    heap_ = heap;
+                    capacity_ = capacity;
+                }
+
+                /* New limbs are zero */
+                void resize(std::size_t size)
+                {
+                    reserve(size);
+                    if (size > size_)
+                        std::fill(data() + size_, data() + size, 0);
+                    size_ = size;
+                }
+
+                void push_back(std::uint64_t limb)
+                {
+                    reserve(size_ + 1);
+                    data()[size_++] = limb;
+                }
+
+                void pop_back() noexcept { --size_; }
+
+                void Assign(const std::uint64_t* limbs, std::size_t size)
+                {
+                    size_ = 0;
+                    reserve(size);
+                    std::copy_n(limbs, size, data());
+                    size_ = size;
+                }
+            };
+
+            /* a[0, an) += b[0, bn) for an >= bn, returns the carry out of the top limb */
+            inline std::uint64_t AddLimbs(std::uint64_t* a, std::size_t an, const std::uint64_t* b, std::size_t bn) noexcept
+            {
+                std::uint64_t carry = 0;
+                std::size_t i = 0;
+                for (; i < bn; ++i)
+                {
+                    const std::uint64_t sum = a[i] + b[i];
+                    const std::uint64_t next = sum < b[i];
+                    a[i] = sum + carry;
+                    carry = next + (a[i] < carry);
+                }
+                for (; carry != 0 && i < an; ++i)
+                    carry = ++a[i] == 0;
+                return carry;
+            }
+
+            /* a[0, an) -= b[0, bn) for an >= bn, returns the borrow out of the top limb */
+            inline std::uint64_t SubLimbs(std::uint64_t* a, std::size_t an, const std::uint64_t* b, std::size_t bn) noexcept
+            {
+                std::uint64_t borrow = 0;
+                std::size_t i = 0;
+                for (; i < bn; ++i)
+                {
+                    const std::uint64_t difference = a[i] - b[i];
+                    const std::uint64_t next = a[i] < b[i];
+                    a[i] = difference - borrow;
+                    borrow = next + (difference < borrow);
+                }
+                for (; borrow != 0 && i < an; ++i)
+                    borrow = a[i]-- == 0;
+                return borrow;
+            }
+
+            /* out[0, n) += a[0, n) * m, returns the carry limb */
+            inline std::uint64_t MulAddLimbs(std::uint64_t* out, const std::uint64_t* a, std::size_t n, std::uint64_t m) noexcept
+            {
+                std::uint64_t carry = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    // a[i] * m + carry + out[i] < 2^128
+                    std::uint64_t high = 0;
+                    std::uint64_t low = MulWide(a[i], m, high);
+                    low += carry;
+                    high += low < carry;
+                    low += out[i];
+                    high += low < out[i];
+                    out[i] = low;
+                    carry = high;
+                }
+                return carry;
+            }
+
+            /* out[0, n) -= a[0, n) * m, returns the borrow limb */
+            inline std::uint64_t MulSubLimbs(std::uint64_t* out, const std::uint64_t* a, std::size_t n, std::uint64_t m) noexcept
+            {
+                std::uint64_t borrow = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    std::uint64_t high = 0;
+                    std::uint64_t low = MulWide(a[i], m, high);
+                    low += borrow;
+                    high += low < borrow;
+                    high += out[i] < low;
+                    out[i] -= low;
+                    borrow = high;
+                }
+                return borrow;
+            }
+
+            /* a[0, n) = a * m + addend in place, returns the carry limb */
+            inline std::uint64_t ScaleLimbs(std::uint64_t* a, std::size_t n, std::uint64_t m, std::uint64_t addend) noexcept
+            {
+                std::uint64_t carry = addend;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    std::uint64_t high = 0;
+                    std::uint64_t low = MulWide(a[i], m, high);
+                    low += carry;
+                    high += low < carry;
+                    a[i] = low;
+                    carry = high;
+                }
+                return carry;
+            }
+
+            /* a[0, n) /= d in place, returns the remainder */
+            inline std::uint64_t DivLimb(std::uint64_t* a, std::size_t n, std::uint64_t d) noexcept
+            {
+                std::uint64_t remainder = 0;
+                for (std::size_t i = n; i-- > 0;)
+                    a[i] = Div128(remainder, a[i], d, remainder);
+                return remainder;
+            }
+
+            /* out[0, an + bn) = a * b by rows of MulAddLimbs(), out must not overlap a or b */
+            inline void MulSchoolbook(std::uint64_t* out, const std::uint64_t* a, std::size_t an, const std::uint64_t* b, std::size_t bn) noexcept
+            {
+                std::fill(out, out + an, 0);
+                for (std::size_t j = 0; j < bn; ++j)
+                    out[an + j] = MulAddLimbs(out + j, a, an, b[j]);
+            }
+
+            /*
+            * Below this many limbs in the shorter operand the schoolbook product is faster than another Karatsuba split, tuned with
+            * balanced operands of 64 to 4096 limbs on x64 (thresholds from 8 to 128 tried, 48 was fastest from 128 limbs on).
+            */
+            inline constexpr std::size_t karatsubaThreshold = 48;
+
+            /*
+            * Below this many limbs in the divisor, or in the quotient, Knuth's algorithm D is faster than another Burnikel-Ziegler split,
+            * tuned with 2n by n divisions of 128 to 3000 limbs on x64 (thresholds from 32 to 128 tried, all within a few percent from 48 on).
+            */
+            inline constexpr std::size_t burnikelZieglerThreshold = 48;
+
+            /*
+            * out[0, an + bn) = a * b, out must not overlap a or b.
+            * Karatsuba with a = a1 * B^h + a0 and b = b1 * B^h + b0: a * b = z2 * B^2h + z1 * B^h + z0 with z0 = a0 * b0, z2 = a1 * b1 and
+            * z1 = (a0 + a1)(b0 + b1) - z0 - z2, three half size products instead of four. Operands twice as long as the other are cut
+            * into pieces of the shorter length first.
+            */
+            inline void MulLimbs(std::uint64_t* out, const std::uint64_t* a, std::size_t an, const std::uint64_t* b, std::size_t bn)
+            {
+                if (an < bn)
+                {
+                    std::swap(a, b);
+                    std::swap(an, bn);
+                }
+                if (bn < karatsubaThreshold)
+                {
+                    MulSchoolbook(out, a, an, b, bn);
+                    return;
+                }
+
+                const std::size_t outSize = an + bn;
+                if (an >= 2 * bn)
+                {
+                    std::fill(out, out + outSize, 0);
+                    std::vector<std::uint64_t> piece(2 * bn);
+                    for (std::size_t i = 0; i < an; i += bn)
+                    {
+                        const std::size_t length = Min(bn, an - i);
+                        MulLimbs(piece.data(), a + i, length, b, bn);
+                        static_cast<void>(AddLimbs(out + i, outSize - i, piece.data(), length + bn));
+                    }
+                    return;
+                }
+
+                // bn > an / 2 >= h, so both high halves are non-empty
+                const std::size_t h = an / 2;
+                MulLimbs(out, a, h, b, h);
+                MulLimbs(out + 2 * h, a + h, an - h, b + h, bn - h);
+
+                // (x mod B^h) + (x / B^h), adding the shorter half to a copy of the longer one
+                const auto halfSum = [h](const std::uint64_t* x, std::size_t n)
+                    {
+                        const std::size_t highSize = n - h;
+                        std::vector<std::uint64_t> sum;
+                        if (highSize >= h)
+                        {
+                            sum.assign(x + h, x + n);
+                            sum.push_back(AddLimbs(sum.data(), highSize, x, h));
+                        }
+                        else
+                        {
+                            sum.assign(x, x + h);
+                            sum.push_back(AddLimbs(sum.data(), h, x + h, highSize));
+                        }
+                        return sum;
+                    };
+                const std::vector<std::uint64_t> aSum = halfSum(a, an), bSum = halfSum(b, bn);
+
+                std::vector<std::uint64_t> middle(aSum.size() + bSum.size());
+                MulLimbs(middle.data(), aSum.data(), aSum.size(), bSum.data(), bSum.size());
+                static_cast<void>(SubLimbs(middle.data(), middle.size(), out, 2 * h));
+                static_cast<void>(SubLimbs(middle.data(), middle.size(), out + 2 * h, outSize - 2 * h));
+
+                // z1 = a0 * b1 + a1 * b0 < B^(outSize - h), the limbs above are zero
+                static_cast<void>(AddLimbs(out + h, outSize - h, middle.data(), Min(middle.size(), outSize - h)));
+            }
+
+            /* dst[0, n) = src[0, n) << shift for shift < 64, returns the bits shifted out */
+            inline std::uint64_t ShiftLimbsLeft(std::uint64_t* dst, const std::uint64_t* src, std::size_t n, int shift) noexcept
+            {
+                if (shift == 0)
+                {
+                    std::copy_n(src, n, dst);
+                    return 0;
+                }
+                std::uint64_t carry = 0;
+                for (std::size_t i = 0; i < n; ++i)
+                {
+                    const std::uint64_t limb = src[i];
+                    dst[i] = (limb << shift) | carry;
+                    carry = limb >> (64 - shift);
+                }
+                return carry;
+            }
+
+            /* a[0, n) >>= shift in place for shift < 64 */
+            inline void ShiftLimbsRight(std::uint64_t* a, std::size_t n, int shift) noexcept
+            {
+                if (shift == 0)
+                    return;
+                for (std::size_t i = 0; i < n; ++i)
+                    a[i] = (a[i] >> shift) | (i + 1 < n ? a[i + 1] << (64 - shift) : 0);
+            }
+
+            /*
+            * Knuth's algorithm D for an >= bn >= 2 and b[bn - 1] != 0: quotient[0, an - bn + 1) = a / b and remainder[0, bn) = a % b.
+            * The divisor is normalized so that its top bit is set, then each quotient limb estimated from the top two limbs of the
+            * running remainder is at most 2 too large; the top three limbs bring that to at most 1, fixed by one add back.
+            */
+            inline void DivModLimbs(const std::uint64_t* a, std::size_t an, const std::uint64_t* b, std::size_t bn, std::uint64_t* quotient, std::uint64_t* remainder)
+            {
+                const int shift = std::countl_zero(b[bn - 1]);
+                std::vector<std::uint64_t> v(bn), u(an + 1);
+                static_cast<void>(ShiftLimbsLeft(v.data(), b, bn, shift));
+                u[an] = ShiftLimbsLeft(u.data(), a, an, shift);
+
+                const std::uint64_t top = v[bn - 1], second = v[bn - 2];
+                for (std::size_t j = an - bn + 1; j-- > 0;)
+                {
+                    std::uint64_t estimate = 0, estimateRemainder = 0;
+                    bool isRemainderWide = false;
+                    if (u[j + bn] >= top)
+                    {
+                        estimate = ~0ULL;
+                        estimateRemainder = u[j + bn - 1] + top;
+                        isRemainderWide = estimateRemainder < top;
+                    }
+                    else
+                        estimate = Div128(u[j + bn], u[j + bn - 1], top, estimateRemainder);
+
+                    while (!isRemainderWide)
+                    {
+                        std::uint64_t high = 0;
+                        const std::uint64_t low = MulWide(estimate, second, high);
+                        if (high < estimateRemainder || (high == estimateRemainder && low <= u[j + bn - 2]))
+                            break;
+                        --estimate;
+                        estimateRemainder += top;
+                        isRemainderWide = estimateRemainder < top;
+                    }
+
+                    const std::uint64_t borrow = MulSubLimbs(u.data() + j, v.data(), bn, estimate);
+                    const bool isNegative = u[j + bn] < borrow;
+                    u[j + bn] -= borrow;
+                    if (isNegative)
+                    {
+                        --estimate;
+                        u[j + bn] += AddLimbs(u.data() + j, bn, v.data(), bn);
+                    }
+                    quotient[j] = estimate;
+                }
+
+                ShiftLimbsRight(u.data(), bn, shift);
+                std::copy_n(u.data(), bn, remainder);
+            }
+        }; // end of namespace detail
+
+        class BigInt
+        {
+        private:
+            detail::LimbBuffer limbs_;      // magnitude, least significant limb first
+            bool isNegative_ = false;
+
+            static constexpr std::uint64_t decimalChunk = 10'000'000'000'000'000'000ULL;     // 10^19, the largest power of 10 in a limb
+            static constexpr std::size_t decimalChunkDigits = 19;
+            static constexpr std::size_t decimalBaseLimbs = 32;                              // decimal conversion below this size is done chunk by chunk
+
+            /* Drops leading zero limbs, zero is not negative */
+            void Trim() noexcept
+            {
+                while (!limbs_.empty() && limbs_.back() == 0)
+                    limbs_.pop_back();
+                if (limbs_.empty())
+                    isNegative_ = false;
+            }
+
+            /* Returns <0, 0 or >0 as |a| is less than, equal to or greater than |b| */
+            static int CompareMagnitude(const BigInt& a, const BigInt& b) noexcept
+            {
+                if (a.limbs_.size() != b.limbs_.size())
+                    return a.limbs_.size() < b.limbs_.size() ? -1 : 1;
+                for (std::size_t i = a.limbs_.size(); i-- > 0;)
+                {
+                    if (a.limbs_[i] != b.limbs_[i])
+                        return a.limbs_[i] < b.limbs_[i] ? -1 : 1;
+                }
+                return 0;
+            }
+
+            /* this += |other| with the sign isOtherNegative, other is not this */
+            void AddSigned(const BigInt& other, bool isOtherNegative)
+            {
+                const std::size_t size = limbs_.size(), otherSize = other.limbs_.size();
+                if (isNegative_ == isOtherNegative)
+                {
+                    limbs_.resize(Max(size, otherSize));
+                    const std::uint64_t carry = detail::AddLimbs(limbs_.data(), limbs_.size(), other.limbs_.data(), otherSize);
+                    if (carry != 0)
+                        limbs_.push_back(carry);
+                }
+                else if (CompareMagnitude(*this, other) >= 0)
+                    static_cast<void>(detail::SubLimbs(limbs_.data(), size, other.limbs_.data(), otherSize));
+                else
+                {
+                    detail::LimbBuffer difference = other.limbs_;
+                    static_cast<void>(detail::SubLimbs(difference.data(), otherSize, limbs_.data(), size));
+                    limbs_ = std::move(difference);
+                    isNegative_ = isOtherNegative;
+                }
+                Trim();
+            }
+
+            /* Appends the decimal digits of 0 <= value, zero padded to width (0 for no padding); value splits at powers[level] */
+            static void AppendDecimal(std::string& digits, BigInt value, const std::vector<BigInt>& powers, std::size_t level, std::size_t width)
+            {
+                while (level > 0 && CompareMagnitude(value, powers[level]) < 0)
+                    --level;
+
+                if (level == 0 || value.limbs_.size() <= decimalBaseLimbs)
+                {
+                    std::vector<std::uint64_t> chunks;
+                    while (!value.limbs_.empty())
+                    {
+                        chunks.push_back(detail::DivLimb(value.limbs_.data(), value.limbs_.size(), decimalChunk));
+                        value.Trim();
+                    }
+
+                    std::string text;
+                    for (std::size_t i = chunks.size(); i-- > 0;)
+                    {
+                        const std::string chunk = std::to_string(chunks[i]);
+                        if (i + 1 < chunks.size())
+                            text.append(decimalChunkDigits - chunk.size(), '0');
+                        text += chunk;
+                    }
+                    if (text.size() < width)
+                        digits.append(width - text.size(), '0');
+                    digits += text;
+                    return;
+                }
+
+                BigInt quotient, remainder;
+                DivMod(value, powers[level], quotient, remainder);
+                const std::size_t lowWidth = decimalChunkDigits << level;
+                AppendDecimal(digits, std::move(quotient), powers, level - 1, width > lowWidth ? width - lowWidth : 0);
+                AppendDecimal(digits, std::move(remainder), powers, level - 1, lowWidth);
+            }
+
+            /* Value of a run of decimal digits, the high part times 10^(19 * 2^level) plus the low part */
+            static BigInt ParseDecimal(std::string_view digits, const std::vector<BigInt>& powers, std::size_t level)
+            {
+                while (level > 0 && (decimalChunkDigits << level) >= digits.size())
+                    --level;
+
+                if (level == 0 || digits.size() <= decimalBaseLimbs * decimalChunkDigits)
+                {
+                    BigInt value;
+                    std::size_t length = digits.size() % decimalChunkDigits;
+                    if (length == 0)
+                        length = decimalChunkDigits;
+                    for (std::size_t i = 0; i < digits.size(); i += length, length = decimalChunkDigits)
+                    {
+                        std::uint64_t chunk = 0, scale = 1;
+                        for (const char digit : digits.substr(i, length))
+                        {
+                            chunk = chunk * 10 + static_cast<std::uint64_t>(digit - '0');
+                            scale *= 10;
+                        }
+                        const std::uint64_t carry = detail::ScaleLimbs(value.limbs_.data(), value.limbs_.size(), scale, chunk);
+                        if (carry != 0)
+                            value.limbs_.push_back(carry);
+                    }
+                    return value;
+                }
+
+                const std::size_t lowDigits = decimalChunkDigits << level;
+                const std::size_t split = digits.size() - lowDigits;
+                BigInt value = ParseDecimal(digits.substr(0, split), powers, level - 1) * powers[level];
+                value += ParseDecimal(digits.substr(split), powers, level - 1);
+                return value;
+            }
+
+            /* powers[k] = 10^(19 * 2^k) for every k with 19 * 2^k below digitCount, at least powers[0] */
+            static std::vector<BigInt> DecimalPowers(std::size_t digitCount)
+            {
+                std::vector<BigInt> powers = { BigInt(decimalChunk) };
+                while ((decimalChunkDigits << powers.size()) < digitCount)
+                    powers.push_back(powers.back() * powers.back());
+                return powers;
+            }
+
+            /* |x| / B^first mod B^count with B = 2^64, the count limbs of x from limb first on */
+            static BigInt LimbRange(const BigInt& x, std::size_t first, std::size_t count)
+            {
+                BigInt range;
+                if (first < x.limbs_.size())
+                {
+                    range.limbs_.Assign(x.limbs_.data() + first, Min(count, x.limbs_.size() - first));
+                    range.Trim();
+                }
+                return range;
+            }
+
+            /* high * B^lowLimbs + low for non-negative high and 0 <= low < B^lowLimbs */
+            static BigInt JoinLimbs(const BigInt& high, const BigInt& low, std::size_t lowLimbs)
+            {
+                if (high.limbs_.empty())
+                    return low;
+                BigInt joined;
+                joined.limbs_.resize(lowLimbs + high.limbs_.size());
+                std::copy_n(low.limbs_.data(), low.limbs_.size(), joined.limbs_.data());
+                std::copy_n(high.limbs_.data(), high.limbs_.size(), joined.limbs_.data() + lowLimbs);
+                return joined;
+            }
+
+            /* |x| * B^limbs * 2^bits for bits < 64 */
+            static BigInt ShiftLeft(const BigInt& x, std::size_t limbs, int bits)
+            {
+                BigInt shifted;
+                shifted.limbs_.resize(x.limbs_.size() + limbs + 1);
+                shifted.limbs_[x.limbs_.size() + limbs] = detail::ShiftLimbsLeft(shifted.limbs_.data() + limbs, x.limbs_.data(), x.limbs_.size(), bits);
+                shifted.Trim();
+                return shifted;
+            }
+
+            /* |x| / (B^limbs * 2^bits) for bits < 64 */
+            static BigInt ShiftRight(const BigInt& x, std::size_t limbs, int bits)
+            {
+                BigInt shifted = LimbRange(x, limbs, x.limbs_.size());
+                detail::ShiftLimbsRight(shifted.limbs_.data(), shifted.limbs_.size(), bits);
+                shifted.Trim();
+                return shifted;
+            }
+
+            /* |a| / |b| and |a| % |b| by Knuth's algorithm D, or by a single limb division for a one limb divisor */
+            static void DivModSchoolbook(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder)
+            {
+                const std::size_t an = a.limbs_.size(), bn = b.limbs_.size();
+                if (CompareMagnitude(a, b) < 0)
+                {
+                    remainder = LimbRange(a, 0, an);
+                    quotient = BigInt();
+                    return;
+                }
+
+                BigInt q, r;
+                q.limbs_.resize(an - bn + 1);
+                if (bn == 1)
+                {
+                    std::copy_n(a.limbs_.data(), an, q.limbs_.data());
+                    r = BigInt(detail::DivLimb(q.limbs_.data(), an, b.limbs_[0]));
+                }
+                else
+                {
+                    r.limbs_.resize(bn);
+                    detail::DivModLimbs(a.limbs_.data(), an, b.limbs_.data(), bn, q.limbs_.data(), r.limbs_.data());
+                }
+                q.Trim();
+                r.Trim();
+                quotient = std::move(q);
+                remainder = std::move(r);
+            }
+
+            /*
+            * Burnikel-Ziegler: a / b and a % b for 0 <= a < b * B^n, b having n limbs and its top bit set. The quotient has n limbs, its
+            * top and bottom halves come from two DivideThreeByTwo() steps on the top and then the bottom 3n/2 limbs of the running remainder.
+            */
+            static void DivideTwoByOne(const BigInt& a, const BigInt& b, std::size_t n, BigInt& quotient, BigInt& remainder)
+            {
+                if (n % 2 != 0 || n < detail::burnikelZieglerThreshold)
+                {
+                    DivModSchoolbook(a, b, quotient, remainder);
+                    return;
+                }
+
+                const std::size_t h = n / 2;
+                BigInt high, low;
+                DivideThreeByTwo(LimbRange(a, h, 3 * h), b, h, high, remainder);
+                DivideThreeByTwo(JoinLimbs(remainder, LimbRange(a, 0, h), h), b, h, low, remainder);
+                quotient = JoinLimbs(high, low, h);
+            }
+
+            /*
+            * a / b and a % b for 0 <= a < b * B^h, b having 2h limbs and its top bit set. The top 2h limbs of a divided by the top half of b
+            * (recursively) give a quotient at most 2 too large, which the product with the low half of b corrects.
+            */
+            static void DivideThreeByTwo(const BigInt& a, const BigInt& b, std::size_t h, BigInt& quotient, BigInt& remainder)
+            {
+                const BigInt bHigh = LimbRange(b, h, h);
+                BigInt partial;
+                // a < b * B^h leaves the top h limbs of a at most bHigh, when equal the quotient is capped at B^h - 1
+                if (CompareMagnitude(LimbRange(a, 2 * h, h), bHigh) < 0)
+                    DivideTwoByOne(LimbRange(a, h, 2 * h), bHigh, h, quotient, partial);
+                else
+                {
+                    quotient = BigInt();
+                    quotient.limbs_.resize(h);
+                    std::fill_n(quotient.limbs_.data(), h, ~0ULL);
+                    partial = LimbRange(a, h, h) + bHigh;
+                }
+
+                remainder = JoinLimbs(partial, LimbRange(a, 0, h), h) - quotient * LimbRange(b, 0, h);
+                while (remainder.isNegative_)
+                {
+                    quotient -= 1;
+                    remainder += b;
+                }
+            }
+
+            /*
+            * |a| / |b| and |a| % |b| by Burnikel-Ziegler. b is scaled to n = m * 2^k limbs with its top bit set and m below the threshold,
+            * so that every halving down to algorithm D is even, and a (scaled alike) is divided n limbs at a time from the top. With
+            * Karatsuba products this costs O(n^1.58 log n) instead of the O(n^2) of algorithm D.
+            */
+            static void DivModRecursive(const BigInt& a, const BigInt& b, BigInt& quotient, BigInt& remainder)
+            {
+                const std::size_t bn = b.limbs_.size();
+                std::size_t levels = 0;
+                while ((bn >> levels) >= detail::burnikelZieglerThreshold)
+                    ++levels;
+                const std::size_t n = (((bn - 1) >> levels) + 1) << levels;
+                const std::size_t padLimbs = n - bn;
+                const int shift = std::countl_zero(b.limbs_.back());
+                const BigInt divisor = ShiftLeft(b, padLimbs, shift);
+                const BigInt dividend = ShiftLeft(a, padLimbs, shift);
+
+                const std::size_t blocks = (dividend.limbs_.size() + n - 1) / n;
+                BigInt q, r;
+                q.limbs_.resize(blocks * n);
+                for (std::size_t i = blocks; i-- > 0;)
+                {
+                    BigInt blockQuotient;
+                    DivideTwoByOne(JoinLimbs(r, LimbRange(dividend, i * n, n), n), divisor, n, blockQuotient, r);
+                    std::copy_n(blockQuotient.limbs_.data(), blockQuotient.limbs_.size(), q.limbs_.data() + i * n);
+                }
+                q.Trim();
+                quotient = std::move(q);
+                remainder = ShiftRight(r, padLimbs, shift);
+            }
+
+        public:
+            BigInt() = default;
+
+            /**
+            * @brief	Integer of the given value, implicit so that integral operands mix with BigInt.
+            * @param	T value : Any integral value.
+            */
+            template <std::integral T>
+            BigInt(T value)
+            {
+                using U = std::make_unsigned_t<T>;
+                U magnitude = static_cast<U>(value);
+                if constexpr (std::is_signed_v<T>)
+                {
+                    if (value < 0)
+                    {
+                        magnitude = static_cast<U>(U(0) - magnitude);
+                        isNegative_ = true;
+                    }
+                }
+                if (magnitude != 0)
+                    limbs_.push_back(static_cast<std::uint64_t>(magnitude));
+            }
+
+            /* Parses an optional '-' followed by decimal digits */
+            [[nodiscard]] static BigInt FromString(std::string_view text)
+            {
+                const bool isNegative = !text.empty() && text.front() == '-';
+                if (isNegative)
+                    text.remove_prefix(1);
+                assert(!text.empty() && std::all_of(text.begin(), text.end(), [](char c) { return c >= '0' && c <= '9'; }) && "FromString: expected decimal digits");
+
+                const std::vector<BigInt> powers = DecimalPowers(text.size());
+                BigInt value = ParseDecimal(text, powers, powers.size() - 1);
+                value.isNegative_ = isNegative && !value.limbs_.empty();
+                return value;
+            }
+
+            [[nodiscard]] bool IsZero() const noexcept { return limbs_.empty(); }
+            [[nodiscard]] bool IsNegative() const noexcept { return isNegative_; }
+
+            /* Number of 64-bit limbs of the magnitude, 0 for zero */
+            [[nodiscard]] std::size_t LimbCount() const noexcept { return limbs_.size(); }
+
+            /* 64-bit limbs of the magnitude, least significant first */
+            [[nodiscard]] std::span<const std::uint64_t> Limbs() const noexcept { return { limbs_.data(), limbs_.size() }; }
+
+            /* Number of bits of the magnitude, 0 for zero */
+            [[nodiscard]] std::size_t BitWidth() const noexcept
+            {
+                return limbs_.empty() ? 0 : (limbs_.size() - 1) * 64 + std::bit_width(limbs_.back());
+            }
+
+            /* Decimal digits with a leading '-' for negative values */
+            [[nodiscard]] std::string ToString() const
+            {
+                if (limbs_.empty())
+                    return "0";
+                BigInt magnitude = *this;
+                magnitude.isNegative_ = false;
+                // 64 bits hold at most 19.27 decimal digits
+                const std::vector<BigInt> powers = DecimalPowers(limbs_.size() * 20 / 2);
+
+                std::string digits = isNegative_ ? "-" : "";
+                digits.reserve(limbs_.size() * 20 + 1);
+                AppendDecimal(digits, std::move(magnitude), powers, powers.size() - 1, 0);
+                return digits;
+            }
+
+            /**
+            * @brief	Truncating division, the quotient rounds toward zero and the remainder takes the sign of the dividend (as for int).
+            * @param	const BigInt& divisor : Non-zero divisor.
+            */
+            static void DivMod(const BigInt& dividend, const BigInt& divisor, BigInt& quotient, BigInt& remainder)
+            {
+                assert(!divisor.IsZero() && "DivMod: division by zero");
+                const bool isQuotientNegative = dividend.isNegative_ != divisor.isNegative_;
+                const bool isRemainderNegative = dividend.isNegative_;
+                const std::size_t an = dividend.limbs_.size(), bn = divisor.limbs_.size();
+
+                BigInt q, r;
+                if (bn >= detail::burnikelZieglerThreshold && an >= bn + detail::burnikelZieglerThreshold)
+                    DivModRecursive(dividend, divisor, q, r);
+                else
+                    DivModSchoolbook(dividend, divisor, q, r);
+                q.isNegative_ = isQuotientNegative && !q.limbs_.empty();
+                r.isNegative_ = isRemainderNegative && !r.limbs_.empty();
+                quotient = std::move(q);
+                remainder = std::move(r);
+            }
+
+            [[nodiscard]] BigInt operator-() const
+            {
+                BigInt negated = *this;
+                negated.isNegative_ = !negated.isNegative_ && !negated.limbs_.empty();
+                return negated;
+            }
+
+            BigInt& operator+=(const BigInt& other)
+            {
+                if (&other == this)
+                    return *this += BigInt(other);
+                AddSigned(other, other.isNegative_);
+                return *this;
+            }
+
+            BigInt& operator-=(const BigInt& other)
+            {
+                if (&other == this)
+                    return *this = BigInt();
+                AddSigned(other, !other.isNegative_ && !other.limbs_.empty());
+                return *this;
+            }
+
+            BigInt& operator*=(const BigInt& other) { return *this = *this * other; }
+            BigInt& operator/=(const BigInt& other) { return *this = *this / other; }
+            BigInt& operator%=(const BigInt& other) { return *this = *this % other; }
+
+            [[nodiscard]] friend BigInt operator+(BigInt a, const BigInt& b) { return a += b; }
+            [[nodiscard]] friend BigInt operator-(BigInt a, const BigInt& b) { return a -= b; }
+
+            [[nodiscard]] friend BigInt operator*(const BigInt& a, const BigInt& b)
+            {
+                BigInt product;
+                if (a.limbs_.empty() || b.limbs_.empty())
+                    return product;
+                product.limbs_.resize(a.limbs_.size() + b.limbs_.size());
+                detail::MulLimbs(product.limbs_.data(), a.limbs_.data(), a.limbs_.size(), b.limbs_.data(), b.limbs_.size());
+                product.isNegative_ = a.isNegative_ != b.isNegative_;
+                product.Trim();
+                return product;
+            }
+
+            [[nodiscard]] friend BigInt operator/(const BigInt& a, const BigInt& b)
+            {
+                BigInt quotient, remainder;
+                DivMod(a, b, quotient, remainder);
+                return quotient;
+            }
+
+            [[nodiscard]] friend BigInt operator%(const BigInt& a, const BigInt& b)
+            {
+                BigInt quotient, remainder;
+                DivMod(a, b, quotient, remainder);
+                return remainder;
+            }
+
+            [[nodiscard]] friend bool operator==(const BigInt& a, const BigInt& b) noexcept
+            {
+                return a.isNegative_ == b.isNegative_ && CompareMagnitude(a, b) == 0;
+            }
+
+            [[nodiscard]] friend std::strong_ordering operator<=>(const BigInt& a, const BigInt& b) noexcept
+            {
+                if (a.isNegative_ != b.isNegative_)
+                    return a.isNegative_ ? std::strong_ordering::less : std::strong_ordering::greater;
+                const int magnitude = a.isNegative_ ? CompareMagnitude(b, a) : CompareMagnitude(a, b);
+                return magnitude <=> 0;
+            }
+
+            friend std::ostream& operator<<(std::ostream& os, const BigInt& value)
+            {
+                return os << value.ToString();
+            }
+        };
+
+        /* Returns base^exponent by squaring */
+        [[nodiscard]] inline BigInt Pow(BigInt base, unsigned long long exponent)
+        {
+            BigInt result = 1;
+            while (exponent > 0)
+            {
+                if (exponent & 1)
+                    result *= base;
+                exponent >>= 1;
+                if (exponent > 0)
+                    base *= base;
+            }
+            return result;
+        }
+
+        /* Returns the non-negative greatest common divisor by Euclid's algorithm */
+        [[nodiscard]] inline BigInt GCD(BigInt a, BigInt b)
+        {
+            while (!b.IsZero())
+            {
+                BigInt remainder = a % b;
+                a = std::move(b);
+                b = std::move(remainder);
+            }
+            return a.IsNegative() ? -a : a;
+        }
+    }; // end of namespace math_utils
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,138 @@
+/*!
+lib\include\utils\binomial_table.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Binomial Table header file.
+
+\note
+Factorial and inverse factorial tables for C(n, k) mod p with a fixed prime p. n! is stored as n! * 2^128 mod p and 1 / n! as is, so
+the two Montgomery products of ModContext::MulResidue() give C(n, k) directly: every Lucas digit is three table loads and two
+multiplications. The tables cover the digits below min(p, capacity), larger digits fall back to ModBinomialSmall(). They are built on
+the first query, once, even when several threads query at the same time.
+*/
+
+#pragma once
+
+#ifndef BINOMIAL_TABLE_HPP_
+#define BINOMIAL_TABLE_HPP_
+
+#include "math_utils.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace winxframe
+{
+    namespace math_utils
+    {
+        class BinomialTable
+        {
+        private:
+            ModContext context_;
+            std::size_t size_;
+            mutable std::once_flag built_;
+            mutable std::vector<unsigned long long> factorials_;            // n! * 2^128 mod p (Montgomery form applied twice)
+            mutable std::vector<unsigned long long> inverseFactorials_;     // (n!)^-1 mod p
+
+            void Build() const
+            {
+                std::vector<unsigned long long> factorials(size_), inverseFactorials(size_);
+                factorials[0] = 1;
+                for (std::size_t i = 1; i < size_; ++i)
+                    factorials[i] = context_.MulMod(factorials[i - 1], i);
+                inverseFactorials[size_ - 1] = context_.InvMod(factorials[size_ - 1]);
+                for (std::size_t i = size_ - 1; i > 0; --i)
+                    inverseFactorials[i - 1] = context_.MulMod(inverseFactorials[i], i);
+                for (unsigned long long& factorial : factorials)
+                    factorial = context_.ToResidue(context_.ToResidue(factorial));
+
+                factorials_ = std::move(factorials);
+                inverseFactorials_ = std::move(inverseFactorials);
+            }
+
+            /* C(n, k) mod p for one Lucas digit, n, k < p */
+            unsigned long long Digit(unsigned long long n, unsigned long long k) const noexcept
+            {
+                if (k > n) return 0;
+                if (n >= size_)
+                    return ModBinomialSmall(n, k, context_);
+                return context_.MulResidue(context_.MulResidue(factorials_[n], inverseFactorials_[k]), inverseFactorials_[n - k]);
+            }
+
+        public:
+            static constexpr std::size_t defaultCapacity = std::size_t{ 1 } << 20;
+
+            /**
+            * @brief	Tables for C(n, k) mod prime, built on the first query.
+            * @param	std::size_t capacity : Largest table size, Lucas digits from min(prime, capacity) on are computed by ModBinomialSmall().
+            */
+            explicit BinomialTable(unsigned long long prime, std::size_t capacity = defaultCapacity) :
+                context_(prime),
+                size_(static_cast<std::size_t>(std::min<unsigned long long>(prime, std::max<std::size_t>(capacity, 1))))
+            {
+                assert(prime > 1 && "BinomialTable: modulus must be a prime");
+            }
+
+            BinomialTable(const BinomialTable&) = delete;
+            BinomialTable& operator=(const BinomialTable&) = delete;
+
+            /* Returns the table of a prime, shared by every caller and kept until the program exits */
+            static const BinomialTable& ForPrime(unsigned long long prime)
+            {
+                static std::mutex mutex;
+                static std::unordered_map<unsigned long long, std::unique_ptr<BinomialTable>> tables;
+                std::lock_guard<std::mutex> lock(mutex);
+                std::unique_ptr<BinomialTable>& table = tables[prime];
+                if (!table)
+                    table = std::make_unique<BinomialTable>(prime);
+                return *table;
+            }
+
+            unsigned long long Prime() const noexcept { return context_.Modulus(); }
+            std::size_t Size() const noexcept { return size_; }
+
+            /* Computes C(n, k) mod p, Lucas' theorem over the base p digits of n and k */
+            unsigned long long Binomial(unsigned long long n, unsigned long long k) const
+            {
+                std::call_once(built_, &BinomialTable::Build, this);
+                if (k > n) return 0;
+
+                const unsigned long long p = context_.Modulus();
+                unsigned long long result = 1;
+                while (k > 0)
+                {
+                    const unsigned long long digit = Digit(n % p, k % p);
+                    if (digit == 0) return 0;
+                    result = context_.MulMod(result, digit);
+                    n /= p;
+                    k /= p;
+                }
+                return result;
+            }
+
+            /* out[i] = C(n[i], k[i]) mod p */
+            void Binomial(std::span<const unsigned long long> n, std::span<const unsigned long long> k, std::span<unsigned long long> out) const
+            {
+                assert(n.size() == out.size() && k.size() == out.size() && "Binomial: input and output sizes differ");
+                std::call_once(built_, &BinomialTable::Build, this);
+                const unsigned long long p = context_.Modulus();
+                for (std::size_t i = 0; i < out.size(); ++i)
+                {
+                    // single digit queries skip the Lucas loop and its divisions
+                    if (n[i] < p)
+                        out[i] = Digit(n[i], k[i]);
+                    else
+                        out[i] = Binomial(n[i], k[i]);
+                }
+            }
+        };
+    }; // end of namespace math_utils
+}; // end of namespace winxframe
+
+#endif
@@ -0,0 +1,821 @@
+/*!
+lib\include\utils\math_batch.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Math Batch header file.
+
+\note
+Span overloads of Exp, Log, Pow, Abs, Clamp, Min and Max for float and double. Blocks of 4 to 16 values go through the kernels of
+math_utils.hpp instantiated on a SIMD register wrapper (SSE2, AVX2 or AVX-512F, chosen at run time from CPUID), the remaining values
+through the scalar functions. The wrappers run the same operations in the same order as the scalar code, and special values are
+blended in afterwards instead of branched on, so every result is bit for bit the scalar one. That holds as long as the compiler does
+not contract a * b + c into fused multiply-adds. MSVC does not under the default /fp:precise. GCC does by default wherever FMA is
+enabled (AVX-512F implies it), so the SIMD regions below and the scalar entry points of math_utils.hpp turn contraction off. Clang
+still contracts within single expressions of the scalar code when FMA is enabled, so such Clang builds need -ffp-contract=off.
+*/
+
+#pragma once
+
+#ifndef MATH_BATCH_HPP_
+#define MATH_BATCH_HPP_
+
+#include "math_utils.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <ostream>
+#include <span>
+#include <type_traits>
+
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    #define MATH_BATCH_X86 1
+    #include <immintrin.h>
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+    #endif
+#else
+    #define MATH_BATCH_X86 0
+#endif
+
+// GCC and Clang only inline intrinsics into functions compiled for their instruction set, so the block loops are flattened and the
+// kernels end up inside a function carrying the target attribute. MSVC accepts every intrinsic anywhere.
+#if defined(__GNUC__)
+    #define MATH_BATCH_FLATTEN __attribute__((flatten))
+    // the register wrappers are passed by value outside the target regions, but only ever inlined into them
+    #pragma GCC diagnostic push
+    #pragma GCC diagnostic ignored "-Wpsabi"
+#else
+    #define MATH_BATCH_FLATTEN
+#endif
+
+namespace winxframe
+{
+    namespace math_utils
+    {
+        /* Instruction sets of the batch functions, ordered by register width */
+        enum class SimdLevel
+        {
+            Scalar,
+            SSE2,
+            AVX2,
+            AVX512
+        };
+
+        inline std::ostream& operator<<(std::ostream& os, SimdLevel level)
+        {
+            constexpr const char* names[] = { "Scalar", "SSE2", "AVX2", "AVX512" };
+            return os << names[static_cast<int>(level)];
+        }
+
+        /* Returns the widest instruction set supported by both the processor and the operating system (which must save the wider registers) */
+        inline SimdLevel DetectSimdLevel() noexcept
+        {
+#if MATH_BATCH_X86
+            static const SimdLevel detected = []()
+                {
+                    auto cpuid = [](unsigned int leaf, unsigned int subleaf, unsigned int(&registers)[4])
+                        {
+#if defined(_MSC_VER)
+                            int values[4];
+                            __cpuidex(values, static_cast<int>(leaf), static_cast<int>(subleaf));
+                            for (int i = 0; i < 4; ++i)
+                                registers[i] = static_cast<unsigned int>(values[i]);
+#else
+                            __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2], registers[3]);
+#endif
+                        };
+
+                    unsigned int registers[4]{};
+                    cpuid(0, 0, registers);
+                    const unsigned int maxLeaf = registers[0];
+                    cpuid(1, 0, registers);
+                    if (!(registers[3] & (1u << 26)))
+                        return SimdLevel::Scalar;
+
+                    // AVX state needs OSXSAVE and XCR0 bits 1-2 (XMM, YMM), AVX-512 additionally bits 5-7 (opmask, ZMM)
+                    const bool hasOsXsave = (registers[2] & (1u << 27)) != 0;
+                    const bool hasAvx = (registers[2] & (1u << 28)) != 0;
+                    if (!hasOsXsave || !hasAvx || maxLeaf < 7)
+                        return SimdLevel::SSE2;
+#if defined(_MSC_VER)
+                    const unsigned long long xcr0 = _xgetbv(0);
+#else
+                    unsigned int xcr0Low = 0, xcr0High = 0;
+                    __asm__ volatile("xgetbv" : "=a"(xcr0Low), "=d"(xcr0High) : "c"(0));
+                    const unsigned long long xcr0 = (static_cast<unsigned long long>(xcr0High) << 32) | xcr0Low;
+#endif
+                    if ((xcr0 & 0x6) != 0x6)
+                        return SimdLevel::SSE2;
+                    cpuid(7, 0, registers);
+                    if (!(registers[1] & (1u << 5)))
+                        return SimdLevel::SSE2;
+                    if (!(registers[1] & (1u << 16)) || (xcr0 & 0xE6) != 0xE6)
+                        return SimdLevel::AVX2;
+                    return SimdLevel::AVX512;
+                }();
+            return detected;
+#else
+            return SimdLevel::Scalar;
+#endif
+        }
+
+        namespace detail
+        {
+            inline std::atomic<SimdLevel>& ActiveSimdLevel() noexcept
+            {
+                static std::atomic<SimdLevel> level{ DetectSimdLevel() };
+                return level;
+            }
+        }; // end of namespace detail
+
+        /* Returns the instruction set the batch functions use, DetectSimdLevel() unless changed by SetSimdLevel() */
+        inline SimdLevel GetSimdLevel() noexcept
+        {
+            return detail::ActiveSimdLevel().load(std::memory_order_relaxed);
+        }
+
+        /* Selects the instruction set of the batch functions, levels above DetectSimdLevel() are lowered to it */
+        inline void SetSimdLevel(SimdLevel level) noexcept
+        {
+            detail::ActiveSimdLevel().store(std::min(level, DetectSimdLevel()), std::memory_order_relaxed);
+        }
+
+        namespace detail
+        {
+            /*
+            * Lanes of one SIMD register, the lane type V of the math_utils kernels. Isa provides the register and mask types and the
+            * operations on them as static functions, see Sse2F32 below. Comparisons return a LaneMask, != is unordered like the scalar one.
+            */
+            template <typename Isa>
+            struct LaneMask
+            {
+                typename Isa::mask_type bits;
+
+                friend LaneMask operator&(LaneMask a, LaneMask b) noexcept { return { Isa::And(a.bits, b.bits) }; }
+                friend LaneMask operator|(LaneMask a, LaneMask b) noexcept { return { Isa::Or(a.bits, b.bits) }; }
+            };
+
+            template <typename Isa>
+            struct Lanes
+            {
+                using value_type = typename Isa::value_type;
+                using register_type = typename Isa::register_type;
+                static constexpr std::size_t width = Isa::width;
+
+                register_type v;
+
+                Lanes() = default;
+                Lanes(register_type value) noexcept : v(value) {}
+                Lanes(value_type value) noexcept : v(Isa::Broadcast(value)) {}
+
+                static Lanes Load(const value_type* source) noexcept { return Isa::Load(source); }
+                void Store(value_type* destination) const noexcept { Isa::Store(destination, v); }
+
+                friend Lanes operator+(Lanes a, Lanes b) noexcept { return Isa::Add(a.v, b.v); }
+                friend Lanes operator-(Lanes a, Lanes b) noexcept { return Isa::Sub(a.v, b.v); }
+                friend Lanes operator*(Lanes a, Lanes b) noexcept { return Isa::Mul(a.v, b.v); }
+                friend Lanes operator/(Lanes a, Lanes b) noexcept { return Isa::Div(a.v, b.v); }
+                friend Lanes operator-(Lanes a) noexcept { return Isa::Negate(a.v); }
+
+                friend LaneMask<Isa> operator==(Lanes a, Lanes b) noexcept { return { Isa::Equal(a.v, b.v) }; }
+                friend LaneMask<Isa> operator!=(Lanes a, Lanes b) noexcept { return { Isa::NotEqual(a.v, b.v) }; }
+                friend LaneMask<Isa> operator<(Lanes a, Lanes b) noexcept { return { Isa::Less(a.v, b.v) }; }
+                friend LaneMask<Isa> operator<=(Lanes a, Lanes b) noexcept { return { Isa::LessEqual(a.v, b.v) }; }
+                friend LaneMask<Isa> operator>(Lanes a, Lanes b) noexcept { return { Isa::Less(b.v, a.v) }; }
+                friend LaneMask<Isa> operator>=(Lanes a, Lanes b) noexcept { return { Isa::LessEqual(b.v, a.v) }; }
+            };
+
+            /* The lane operations of math_utils.hpp, found through argument-dependent lookup when the kernels are instantiated */
+            template <typename Isa>
+            [[nodiscard]] inline Lanes<Isa> Select(LaneMask<Isa> condition, Lanes<Isa> a, Lanes<Isa> b) noexcept
+            {
+                return Isa::Blend(condition.bits, a.v, b.v);
+            }
+
+            template <typename Isa>
+            [[nodiscard]] inline Lanes<Isa> Truncate(Lanes<Isa> x) noexcept
+            {
+                return Isa::Truncate(x.v);
+            }
+
+            template <typename Isa>
+            [[nodiscard]] inline Lanes<Isa> Pow2Of(Lanes<Isa> k) noexcept
+            {
+                return Isa::Pow2Of(k.v);
+            }
+
+            template <typename Isa>
+            [[nodiscard]] inline Lanes<Isa> SplitExponent(Lanes<Isa> x, Lanes<Isa>& exponent) noexcept
+            {
+                return Isa::SplitExponent(x.v, exponent.v);
+            }
+
+            template <typename Isa>
+            [[nodiscard]] inline LaneMask<Isa> SignBit(Lanes<Isa> x) noexcept
+            {
+                return { Isa::SignBit(x.v) };
+            }
+
+            /* a < b ? a : b and a > b ? a : b, the second operand is returned for NaN like the scalar Min() and Max() */
+            template <typename Isa>
+            [[nodiscard]] inline Lanes<Isa> Minimum(Lanes<Isa> a, Lanes<Isa> b) noexcept
+            {
+                return Isa::Min(a.v, b.v);
+            }
+
+            template <typename Isa>
+            [[nodiscard]] inline Lanes<Isa> Maximum(Lanes<Isa> a, Lanes<Isa> b) noexcept
+            {
+                return Isa::Max(a.v, b.v);
+            }
+
+            /* Scalar Abs() on lanes: +0 for both zeros, NaN keeps its sign */
+            template <typename V>
+            [[nodiscard]] inline V AbsLanes(V x) noexcept
+            {
+                using T = lane_t<V>;
+                return Select(x == static_cast<T>(0), V(static_cast<T>(0)), Select(x < static_cast<T>(0), -x, x));
+            }
+
+#if MATH_BATCH_X86
+    #if defined(__clang__)
+        #pragma clang attribute push(__attribute__((target("sse2"))), apply_to = function)
+    #elif defined(__GNUC__)
+        #pragma GCC push_options
+        #pragma GCC target("sse2")
+        #pragma GCC optimize("fp-contract=off")
+    #endif
+            struct Sse2F32
+            {
+                using value_type = float;
+                using register_type = __m128;
+                using mask_type = __m128;
+                static constexpr std::size_t width = 4;
+
+                static __m128 Broadcast(float x) noexcept { return _mm_set1_ps(x); }
+                static __m128 Load(const float* source) noexcept { return _mm_loadu_ps(source); }
+                static void Store(float* destination, __m128 x) noexcept { _mm_storeu_ps(destination, x); }
+                static __m128 Add(__m128 a, __m128 b) noexcept { return _mm_add_ps(a, b); }
+                static __m128 Sub(__m128 a, __m128 b) noexcept { return _mm_sub_ps(a, b); }
+                static __m128 Mul(__m128 a, __m128 b) noexcept { return _mm_mul_ps(a, b); }
+                static __m128 Div(__m128 a, __m128 b) noexcept { return _mm_div_ps(a, b); }
+                static __m128 Negate(__m128 a) noexcept { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+                static __m128 Min(__m128 a, __m128 b) noexcept { return _mm_min_ps(a, b); }
+                static __m128 Max(__m128 a, __m128 b) noexcept { return _mm_max_ps(a, b); }
+
+                static __m128 Equal(__m128 a, __m128 b) noexcept { return _mm_cmpeq_ps(a, b); }
+                static __m128 NotEqual(__m128 a, __m128 b) noexcept { return _mm_cmpneq_ps(a, b); }
+                static __m128 Less(__m128 a, __m128 b) noexcept { return _mm_cmplt_ps(a, b); }
+                static __m128 LessEqual(__m128 a, __m128 b) noexcept { return _mm_cmple_ps(a, b); }
+                static __m128 And(__m128 a, __m128 b) noexcept { return _mm_and_ps(a, b); }
+                static __m128 Or(__m128 a, __m128 b) noexcept { return _mm_or_ps(a, b); }
+                static __m128 Blend(__m128 mask, __m128 a, __m128 b) noexcept { return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b)); }
+                static __m128 SignBit(__m128 x) noexcept { return _mm_castsi128_ps(_mm_srai_epi32(_mm_castps_si128(x), 31)); }
+
+                static __m128 Truncate(__m128 x) noexcept { return _mm_cvtepi32_ps(_mm_cvttps_epi32(x)); }
+
+                // k + 2^23 + 127 holds k + 127 in the low mantissa bits, shifted into the exponent field
+                static __m128 Pow2Of(__m128 k) noexcept
+                {
+                    return _mm_castsi128_ps(_mm_slli_epi32(_mm_castps_si128(_mm_add_ps(k, _mm_set1_ps(8388608.0f + 127.0f))), 23));
+                }
+
+                static __m128 SplitExponent(__m128 x, __m128& exponent) noexcept
+                {
+                    const __m128i bits = _mm_castps_si128(x);
+                    const __m128i biased = _mm_srli_epi32(bits, 23);
+                    exponent = _mm_add_ps(exponent, _mm_cvtepi32_ps(_mm_sub_epi32(biased, _mm_set1_epi32(127))));
+                    return _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(0x3F800000)));
+                }
+            };
+
+            struct Sse2F64
+            {
+                using value_type = double;
+                using register_type = __m128d;
+                using mask_type = __m128d;
+                static constexpr std::size_t width = 2;
+
+                static __m128d Broadcast(double x) noexcept { return _mm_set1_pd(x); }
+                static __m128d Load(const double* source) noexcept { return _mm_loadu_pd(source); }
+                static void Store(double* destination, __m128d x) noexcept { _mm_storeu_pd(destination, x); }
+                static __m128d Add(__m128d a, __m128d b) noexcept { return _mm_add_pd(a, b); }
+                static __m128d Sub(__m128d a, __m128d b) noexcept { return _mm_sub_pd(a, b); }
+                static __m128d Mul(__m128d a, __m128d b) noexcept { return _mm_mul_pd(a, b); }
+                static __m128d Div(__m128d a, __m128d b) noexcept { return _mm_div_pd(a, b); }
+                static __m128d Negate(__m128d a) noexcept { return _mm_xor_pd(a, _mm_set1_pd(-0.0)); }
+                static __m128d Min(__m128d a, __m128d b) noexcept { return _mm_min_pd(a, b); }
+                static __m128d Max(__m128d a, __m128d b) noexcept { return _mm_max_pd(a, b); }
+
+                static __m128d Equal(__m128d a, __m128d b) noexcept { return _mm_cmpeq_pd(a, b); }
+                static __m128d NotEqual(__m128d a, __m128d b) noexcept { return _mm_cmpneq_pd(a, b); }
+                static __m128d Less(__m128d a, __m128d b) noexcept { return _mm_cmplt_pd(a, b); }
+                static __m128d LessEqual(__m128d a, __m128d b) noexcept { return _mm_cmple_pd(a, b); }
+                static __m128d And(__m128d a, __m128d b) noexcept { return _mm_and_pd(a, b); }
+                static __m128d Or(__m128d a, __m128d b) noexcept { return _mm_or_pd(a, b); }
+                static __m128d Blend(__m128d mask, __m128d a, __m128d b) noexcept { return _mm_or_pd(_mm_and_pd(mask, a), _mm_andnot_pd(mask, b)); }
+
+                // SSE2 has no 64-bit arithmetic shift, the sign of the high half is copied to both halves
+                static __m128d SignBit(__m128d x) noexcept
+                {
+                    return _mm_castsi128_pd(_mm_shuffle_epi32(_mm_srai_epi32(_mm_castpd_si128(x), 31), _MM_SHUFFLE(3, 3, 1, 1)));
+                }
+
+                static __m128d Truncate(__m128d x) noexcept { return _mm_cvtepi32_pd(_mm_cvttpd_epi32(x)); }
+
+                static __m128d Pow2Of(__m128d k) noexcept
+                {
+                    return _mm_castsi128_pd(_mm_slli_epi64(_mm_castpd_si128(_mm_add_pd(k, _mm_set1_pd(4503599627370496.0 + 1023.0))), 52));
+                }
+
+                // the biased exponent becomes a double by placing it in the mantissa of 2^52 and subtracting 2^52
+                static __m128d SplitExponent(__m128d x, __m128d& exponent) noexcept
+                {
+                    const __m128i bits = _mm_castpd_si128(x);
+                    const __m128i biased = _mm_srli_epi64(bits, 52);
+                    const __m128d biasedValue = _mm_sub_pd(_mm_castsi128_pd(_mm_or_si128(biased, _mm_castpd_si128(_mm_set1_pd(4503599627370496.0)))), _mm_set1_pd(4503599627370496.0));
+                    exponent = _mm_add_pd(exponent, _mm_sub_pd(biasedValue, _mm_set1_pd(1023.0)));
+                    const __m128i mantissa = _mm_and_si128(bits, _mm_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+                    return _mm_castsi128_pd(_mm_or_si128(mantissa, _mm_set1_epi64x(0x3FF0000000000000LL)));
+                }
+            };
+
+            struct Sse2
+            {
+                template <typename T>
+                using lanes_type = Lanes<std::conditional_t<std::is_same_v<T, float>, Sse2F32, Sse2F64>>;
+
+                /* Calls kernel(V{}, i) for every full block of V::width values and returns the number of values processed */
+                template <typename V, typename Kernel>
+                MATH_BATCH_FLATTEN static std::size_t ForEachBlock(std::size_t count, Kernel& kernel) noexcept
+                {
+                    std::size_t i = 0;
+                    for (; i + V::width <= count; i += V::width)
+                        kernel(V{}, i);
+                    return i;
+                }
+            };
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #elif defined(__GNUC__)
+        #pragma GCC pop_options
+    #endif
+
+    #if defined(__clang__)
+        #pragma clang attribute push(__attribute__((target("avx2"))), apply_to = function)
+    #elif defined(__GNUC__)
+        #pragma GCC push_options
+        #pragma GCC target("avx2")
+        #pragma GCC optimize("fp-contract=off")
+    #endif
+            struct Avx2F32
+            {
+                using value_type = float;
+                using register_type = __m256;
+                using mask_type = __m256;
+                static constexpr std::size_t width = 8;
+
+                static __m256 Broadcast(float x) noexcept { return _mm256_set1_ps(x); }
+                static __m256 Load(const float* source) noexcept { return _mm256_loadu_ps(source); }
+                static void Store(float* destination, __m256 x) noexcept { _mm256_storeu_ps(destination, x); }
+                static __m256 Add(__m256 a, __m256 b) noexcept { return _mm256_add_ps(a, b); }
+                static __m256 Sub(__m256 a, __m256 b) noexcept { return _mm256_sub_ps(a, b); }
+                static __m256 Mul(__m256 a, __m256 b) noexcept { return _mm256_mul_ps(a, b); }
+                static __m256 Div(__m256 a, __m256 b) noexcept { return _mm256_div_ps(a, b); }
+                static __m256 Negate(__m256 a) noexcept { return _mm256_xor_ps(a, _mm256_set1_ps(-0.0f)); }
+                static __m256 Min(__m256 a, __m256 b) noexcept { return _mm256_min_ps(a, b); }
+                static __m256 Max(__m256 a, __m256 b) noexcept { return _mm256_max_ps(a, b); }
+
+                static __m256 Equal(__m256 a, __m256 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_EQ_OQ); }
+                static __m256 NotEqual(__m256 a, __m256 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_NEQ_UQ); }
+                static __m256 Less(__m256 a, __m256 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+                static __m256 LessEqual(__m256 a, __m256 b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+                static __m256 And(__m256 a, __m256 b) noexcept { return _mm256_and_ps(a, b); }
+                static __m256 Or(__m256 a, __m256 b) noexcept { return _mm256_or_ps(a, b); }
+                static __m256 Blend(__m256 mask, __m256 a, __m256 b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+                static __m256 SignBit(__m256 x) noexcept { return _mm256_castsi256_ps(_mm256_srai_epi32(_mm256_castps_si256(x), 31)); }
+
+                static __m256 Truncate(__m256 x) noexcept { return _mm256_cvtepi32_ps(_mm256_cvttps_epi32(x)); }
+
+                static __m256 Pow2Of(__m256 k) noexcept
+                {
+                    return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_castps_si256(_mm256_add_ps(k, _mm256_set1_ps(8388608.0f + 127.0f))), 23));
+                }
+
+                static __m256 SplitExponent(__m256 x, __m256& exponent) noexcept
+                {
+                    const __m256i bits = _mm256_castps_si256(x);
+                    const __m256i biased = _mm256_srli_epi32(bits, 23);
+                    exponent = _mm256_add_ps(exponent, _mm256_cvtepi32_ps(_mm256_sub_epi32(biased, _mm256_set1_epi32(127))));
+                    return _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(0x3F800000)));
+                }
+            };
+
+            struct Avx2F64
+            {
+                using value_type = double;
+                using register_type = __m256d;
+                using mask_type = __m256d;
+                static constexpr std::size_t width = 4;
+
+                static __m256d Broadcast(double x) noexcept { return _mm256_set1_pd(x); }
+                static __m256d Load(const double* source) noexcept { return _mm256_loadu_pd(source); }
+                static void Store(double* destination, __m256d x) noexcept { _mm256_storeu_pd(destination, x); }
+                static __m256d Add(__m256d a, __m256d b) noexcept { return _mm256_add_pd(a, b); }
+                static __m256d Sub(__m256d a, __m256d b) noexcept { return _mm256_sub_pd(a, b); }
+                static __m256d Mul(__m256d a, __m256d b) noexcept { return _mm256_mul_pd(a, b); }
+                static __m256d Div(__m256d a, __m256d b) noexcept { return _mm256_div_pd(a, b); }
+                static __m256d Negate(__m256d a) noexcept { return _mm256_xor_pd(a, _mm256_set1_pd(-0.0)); }
+                static __m256d Min(__m256d a, __m256d b) noexcept { return _mm256_min_pd(a, b); }
+                static __m256d Max(__m256d a, __m256d b) noexcept { return _mm256_max_pd(a, b); }
+
+                static __m256d Equal(__m256d a, __m256d b) noexcept { return _mm256_cmp_pd(a, b, _CMP_EQ_OQ); }
+                static __m256d NotEqual(__m256d a, __m256d b) noexcept { return _mm256_cmp_pd(a, b, _CMP_NEQ_UQ); }
+                static __m256d Less(__m256d a, __m256d b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LT_OQ); }
+                static __m256d LessEqual(__m256d a, __m256d b) noexcept { return _mm256_cmp_pd(a, b, _CMP_LE_OQ); }
+                static __m256d And(__m256d a, __m256d b) noexcept { return _mm256_and_pd(a, b); }
+                static __m256d Or(__m256d a, __m256d b) noexcept { return _mm256_or_pd(a, b); }
+                static __m256d Blend(__m256d mask, __m256d a, __m256d b) noexcept { return _mm256_blendv_pd(b, a, mask); }
+                static __m256d SignBit(__m256d x) noexcept { return _mm256_castsi256_pd(_mm256_cmpgt_epi64(_mm256_setzero_si256(), _mm256_castpd_si256(x))); }
+
+                static __m256d Truncate(__m256d x) noexcept { return _mm256_cvtepi32_pd(_mm256_cvttpd_epi32(x)); }
+
+                static __m256d Pow2Of(__m256d k) noexcept
+                {
+                    return _mm256_castsi256_pd(_mm256_slli_epi64(_mm256_castpd_si256(_mm256_add_pd(k, _mm256_set1_pd(4503599627370496.0 + 1023.0))), 52));
+                }
+
+                static __m256d SplitExponent(__m256d x, __m256d& exponent) noexcept
+                {
+                    const __m256i bits = _mm256_castpd_si256(x);
+                    const __m256i biased = _mm256_srli_epi64(bits, 52);
+                    const __m256d biasedValue = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(biased, _mm256_castpd_si256(_mm256_set1_pd(4503599627370496.0)))), _mm256_set1_pd(4503599627370496.0));
+                    exponent = _mm256_add_pd(exponent, _mm256_sub_pd(biasedValue, _mm256_set1_pd(1023.0)));
+                    const __m256i mantissa = _mm256_and_si256(bits, _mm256_set1_epi64x(0x000FFFFFFFFFFFFFLL));
+                    return _mm256_castsi256_pd(_mm256_or_si256(mantissa, _mm256_set1_epi64x(0x3FF0000000000000LL)));
+                }
+            };
+
+            struct Avx2
+            {
+                template <typename T>
+                using lanes_type = Lanes<std::conditional_t<std::is_same_v<T, float>, Avx2F32, Avx2F64>>;
+
+                template <typename V, typename Kernel>
+                MATH_BATCH_FLATTEN static std::size_t ForEachBlock(std::size_t count, Kernel& kernel) noexcept
+                {
+                    std::size_t i = 0;
+                    for (; i + V::width <= count; i += V::width)
+                        kernel(V{}, i);
+                    return i;
+                }
+            };
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #elif defined(__GNUC__)
+        #pragma GCC pop_options
+    #endif
+
+    #if defined(__clang__)
+        #pragma clang attribute push(__attribute__((target("avx512f"))), apply_to = function)
+    #elif defined(__GNUC__)
+        #pragma GCC push_options
+        #pragma GCC target("avx512f")
+        #pragma GCC optimize("fp-contract=off")
+    #endif
+            // AVX-512F only: the floating point logic instructions (and, or, xor) are AVX-512DQ, so the integer forms are used instead
+            struct Avx512F32
+            {
+                using value_type = float;
+                using register_type = __m512;
+                using mask_type = __mmask16;
+                static constexpr std::size_t width = 16;
+
+                static __m512 Broadcast(float x) noexcept { return _mm512_set1_ps(x); }
+                static __m512 Load(const float* source) noexcept { return _mm512_loadu_ps(source); }
+                static void Store(float* destination, __m512 x) noexcept { _mm512_storeu_ps(destination, x); }
+                static __m512 Add(__m512 a, __m512 b) noexcept { return _mm512_add_ps(a, b); }
+                static __m512 Sub(__m512 a, __m512 b) noexcept { return _mm512_sub_ps(a, b); }
+                static __m512 Mul(__m512 a, __m512 b) noexcept { return _mm512_mul_ps(a, b); }
+                static __m512 Div(__m512 a, __m512 b) noexcept { return _mm512_div_ps(a, b); }
+                static __m512 Negate(__m512 a) noexcept { return _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(a), _mm512_set1_epi32(INT_MIN))); }
+                static __m512 Min(__m512 a, __m512 b) noexcept { return _mm512_min_ps(a, b); }
+                static __m512 Max(__m512 a, __m512 b) noexcept { return _mm512_max_ps(a, b); }
+
+                static __mmask16 Equal(__m512 a, __m512 b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_EQ_OQ); }
+                static __mmask16 NotEqual(__m512 a, __m512 b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_NEQ_UQ); }
+                static __mmask16 Less(__m512 a, __m512 b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LT_OQ); }
+                static __mmask16 LessEqual(__m512 a, __m512 b) noexcept { return _mm512_cmp_ps_mask(a, b, _CMP_LE_OQ); }
+                static __mmask16 And(__mmask16 a, __mmask16 b) noexcept { return static_cast<__mmask16>(a & b); }
+                static __mmask16 Or(__mmask16 a, __mmask16 b) noexcept { return static_cast<__mmask16>(a | b); }
+                static __m512 Blend(__mmask16 mask, __m512 a, __m512 b) noexcept { return _mm512_mask_blend_ps(mask, b, a); }
+                static __mmask16 SignBit(__m512 x) noexcept { return _mm512_cmplt_epi32_mask(_mm512_castps_si512(x), _mm512_setzero_si512()); }
+
+                static __m512 Truncate(__m512 x) noexcept { return _mm512_cvtepi32_ps(_mm512_cvttps_epi32(x)); }
+
+                static __m512 Pow2Of(__m512 k) noexcept
+                {
+                    return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_castps_si512(_mm512_add_ps(k, _mm512_set1_ps(8388608.0f + 127.0f))), 23));
+                }
+
+                static __m512 SplitExponent(__m512 x, __m512& exponent) noexcept
+                {
+                    const __m512i bits = _mm512_castps_si512(x);
+                    const __m512i biased = _mm512_srli_epi32(bits, 23);
+                    exponent = _mm512_add_ps(exponent, _mm512_cvtepi32_ps(_mm512_sub_epi32(biased, _mm512_set1_epi32(127))));
+                    return _mm512_castsi512_ps(_mm512_or_si512(_mm512_and_si512(bits, _mm512_set1_epi32(0x007FFFFF)), _mm512_set1_epi32(0x3F800000)));
+                }
+            };
+
+            struct Avx512F64
+            {
+                using value_type = double;
+                using register_type = __m512d;
+                using mask_type = __mmask8;
+                static constexpr std::size_t width = 8;
+
+                static __m512d Broadcast(double x) noexcept { return _mm512_set1_pd(x); }
+                static __m512d Load(const double* source) noexcept { return _mm512_loadu_pd(source); }
+                static void Store(double* destination, __m512d x) noexcept { _mm512_storeu_pd(destination, x); }
+                static __m512d Add(__m512d a, __m512d b) noexcept { return _mm512_add_pd(a, b); }
+                static __m512d Sub(__m512d a, __m512d b) noexcept { return _mm512_sub_pd(a, b); }
+                static __m512d Mul(__m512d a, __m512d b) noexcept { return _mm512_mul_pd(a, b); }
+                static __m512d Div(__m512d a, __m512d b) noexcept { return _mm512_div_pd(a, b); }
+                static __m512d Negate(__m512d a) noexcept { return _mm512_castsi512_pd(_mm512_xor_si512(_mm512_castpd_si512(a), _mm512_set1_epi64(LLONG_MIN))); }
+                static __m512d Min(__m512d a, __m512d b) noexcept { return _mm512_min_pd(a, b); }
+                static __m512d Max(__m512d a, __m512d b) noexcept { return _mm512_max_pd(a, b); }
+
+                static __mmask8 Equal(__m512d a, __m512d b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_EQ_OQ); }
+                static __mmask8 NotEqual(__m512d a, __m512d b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_NEQ_UQ); }
+                static __mmask8 Less(__m512d a, __m512d b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LT_OQ); }
+                static __mmask8 LessEqual(__m512d a, __m512d b) noexcept { return _mm512_cmp_pd_mask(a, b, _CMP_LE_OQ); }
+                static __mmask8 And(__mmask8 a, __mmask8 b) noexcept { return static_cast<__mmask8>(a & b); }
+                static __mmask8 Or(__mmask8 a, __mmask8 b) noexcept { return static_cast<__mmask8>(a | b); }
+                static __m512d Blend(__mmask8 mask, __m512d a, __m512d b) noexcept { return _mm512_mask_blend_pd(mask, b, a); }
+                static __mmask8 SignBit(__m512d x) noexcept { return _mm512_cmplt_epi64_mask(_mm512_castpd_si512(x), _mm512_setzero_si512()); }
+
+                static __m512d Truncate(__m512d x) noexcept { return _mm512_cvtepi32_pd(_mm512_cvttpd_epi32(x)); }
+
+                static __m512d Pow2Of(__m512d k) noexcept
+                {
+                    return _mm512_castsi512_pd(_mm512_slli_epi64(_mm512_castpd_si512(_mm512_add_pd(k, _mm512_set1_pd(4503599627370496.0 + 1023.0))), 52));
+                }
+
+                static __m512d SplitExponent(__m512d x, __m512d& exponent) noexcept
+                {
+                    const __m512i bits = _mm512_castpd_si512(x);
+                    const __m512i biased = _mm512_srli_epi64(bits, 52);
+                    const __m512d biasedValue = _mm512_sub_pd(_mm512_castsi512_pd(_mm512_or_si512(biased, _mm512_castpd_si512(_mm512_set1_pd(4503599627370496.0)))), _mm512_set1_pd(4503599627370496.0));
+                    exponent = _mm512_add_pd(exponent, _mm512_sub_pd(biasedValue, _mm512_set1_pd(1023.0)));
+                    const __m512i mantissa = _mm512_and_si512(bits, _mm512_set1_epi64(0x000FFFFFFFFFFFFFLL));
+                    return _mm512_castsi512_pd(_mm512_or_si512(mantissa, _mm512_set1_epi64(0x3FF0000000000000LL)));
+                }
+            };
+
+            struct Avx512
+            {
+                template <typename T>
+                using lanes_type = Lanes<std::conditional_t<std::is_same_v<T, float>, Avx512F32, Avx512F64>>;
+
+                template <typename V, typename Kernel>
+                MATH_BATCH_FLATTEN static std::size_t ForEachBlock(std::size_t count, Kernel& kernel) noexcept
+                {
+                    std::size_t i = 0;
+                    for (; i + V::width <= count; i += V::width)
+                        kernel(V{}, i);
+                    return i;
+                }
+            };
+    #if defined(__clang__)
+        #pragma clang attribute pop
+    #elif defined(__GNUC__)
+        #pragma GCC pop_options
+    #endif
+#endif
+
+            /*
+            * Runs kernel(V{}, i) over the full blocks of the active instruction set, then scalar(i) over the rest. Both write out[i], the
+            * kernel for V::width values starting at i.
+            */
+            template <typename T, typename Kernel, typename Scalar>
+            inline void Transform(std::size_t count, Kernel kernel, Scalar scalar) noexcept
+            {
+                std::size_t done = 0;
+                switch (GetSimdLevel())
+                {
+#if MATH_BATCH_X86
+                case SimdLevel::AVX512:
+                    done = Avx512::ForEachBlock<typename Avx512::template lanes_type<T>>(count, kernel);
+                    break;
+                case SimdLevel::AVX2:
+                    done = Avx2::ForEachBlock<typename Avx2::template lanes_type<T>>(count, kernel);
+                    break;
+                case SimdLevel::SSE2:
+                    done = Sse2::ForEachBlock<typename Sse2::template lanes_type<T>>(count, kernel);
+                    break;
+#endif
+                default:
+                    break;
+                }
+                for (std::size_t i = done; i < count; ++i)
+                    scalar(i);
+            }
+
+            /* Exp() with the special cases blended in, in reverse order of the scalar early returns */
+            template <typename V>
+            [[nodiscard]] inline V ExpLanes(V x) noexcept
+            {
+                using T = lane_t<V>;
+                using kernel = ExpLogKernel<T>;
+                V result = ExpReduced(x, V(static_cast<T>(0)));
+                result = Select(AbsLanes(x) < std::numeric_limits<T>::epsilon(), static_cast<T>(1) + x, result);
+                result = Select(x < kernel::minExp, V(static_cast<T>(0)), result);
+                result = Select(x > kernel::maxExp, V(std::numeric_limits<T>::infinity()), result);
+                return Select(x != x, x, result);
+            }
+
+            /* LogUnchecked() on lanes */
+            template <typename V>
+            [[nodiscard]] inline V LogLanes(V x) noexcept
+            {
+                using T = lane_t<V>;
+                V result = LogReduced(x);
+                result = Select(x == std::numeric_limits<T>::infinity(), x, result);
+                result = Select(x == static_cast<T>(0), V(-std::numeric_limits<T>::infinity()), result);
+                result = Select(x < static_cast<T>(0), V(std::numeric_limits<T>::quiet_NaN()), result);
+                return Select(x != x, x, result);
+            }
+
+            /* Pow(T, T) on lanes for a finite nonzero exponent shared by all lanes, parity being IntegerParity(exponent) */
+            template <typename V>
+            [[nodiscard]] inline V PowLanes(V base, lane_t<V> exponent, int parity) noexcept
+            {
+                using T = lane_t<V>;
+                using kernel = ExpLogKernel<T>;
+                constexpr T infinity = std::numeric_limits<T>::infinity();
+                V result;
+                if (parity != 0 && Abs(exponent) <= static_cast<T>(64))
+                    result = PowIntegral(base, static_cast<int>(exponent));
+                else
+                {
+                    const V magnitude = AbsLanes(base);
+                    const V sign = parity == 1 ? Select(SignBit(base), V(static_cast<T>(-1)), V(static_cast<T>(1))) : V(static_cast<T>(1));
+
+                    V logHi, logLo;
+                    LogExtended(magnitude, logHi, logLo);
+                    const V productEstimate = exponent * logHi;
+                    V productHi, productLo;
+                    TwoProduct(V(exponent), logHi, productHi, productLo);
+                    productLo = productLo + exponent * logLo;
+                    result = sign * ExpReduced(productHi, productLo);
+
+                    result = Select(AbsLanes(productEstimate) < std::numeric_limits<T>::epsilon(), sign * (static_cast<T>(1) + productEstimate), result);
+                    result = Select(productEstimate < kernel::minExp, sign * static_cast<T>(0), result);
+                    result = Select(productEstimate > kernel::maxExp, sign * infinity, result);
+                    // only finite negative bases need an integral exponent, the zero and infinite bases below override it
+                    if (parity == 0)
+                        result = Select(base < static_cast<T>(0), V(std::numeric_limits<T>::quiet_NaN()), result);
+                    const V zeroOrInfinity = exponent > static_cast<T>(0) ? Select(magnitude == infinity, V(infinity), V(static_cast<T>(0))) :
+                        Select(magnitude == infinity, V(static_cast<T>(0)), V(infinity));
+                    result = Select((magnitude == static_cast<T>(0)) | (magnitude == infinity), sign * zeroOrInfinity, result);
+                }
+                result = Select(base != base, base + exponent, result);
+                return Select(base == static_cast<T>(1), V(static_cast<T>(1)), result);
+            }
+
+            template <typename T>
+            inline void ExpBatch(std::span<const T> x, std::span<T> out) noexcept
+            {
+                assert(x.size() == out.size() && "Exp: input and output sizes differ");
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        ExpLanes(V::Load(&x[i])).Store(&out[i]);
+                    };
+                Transform<T>(x.size(), kernel, [&](std::size_t i) { out[i] = Exp(x[i]); });
+            }
+
+            template <typename T>
+            inline void LogBatch(std::span<const T> x, std::span<T> out) noexcept
+            {
+                assert(x.size() == out.size() && "Log: input and output sizes differ");
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        LogLanes(V::Load(&x[i])).Store(&out[i]);
+                    };
+                Transform<T>(x.size(), kernel, [&](std::size_t i) { out[i] = LogUnchecked(x[i]); });
+            }
+
+            template <typename T>
+            inline void PowBatch(std::span<const T> base, T exponent, std::span<T> out) noexcept
+            {
+                assert(base.size() == out.size() && "Pow: input and output sizes differ");
+                // zero, infinite and NaN exponents give constants or NaN propagation, not worth a vector path
+                if (exponent == static_cast<T>(0) || exponent != exponent || Abs(exponent) == std::numeric_limits<T>::infinity())
+                {
+                    for (std::size_t i = 0; i < base.size(); ++i)
+                        out[i] = Pow(base[i], exponent);
+                    return;
+                }
+                const int parity = IntegerParity(exponent);
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        PowLanes(V::Load(&base[i]), exponent, parity).Store(&out[i]);
+                    };
+                Transform<T>(base.size(), kernel, [&](std::size_t i) { out[i] = Pow(base[i], exponent); });
+            }
+
+            template <typename T>
+            inline void AbsBatch(std::span<const T> x, std::span<T> out) noexcept
+            {
+                assert(x.size() == out.size() && "Abs: input and output sizes differ");
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        AbsLanes(V::Load(&x[i])).Store(&out[i]);
+                    };
+                Transform<T>(x.size(), kernel, [&](std::size_t i) { out[i] = Abs(x[i]); });
+            }
+
+            template <typename T>
+            inline void ClampBatch(std::span<const T> x, T minVal, T maxVal, std::span<T> out) noexcept
+            {
+                assert(x.size() == out.size() && "Clamp: input and output sizes differ");
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        const V val = V::Load(&x[i]);
+                        // val > maxVal ? maxVal : val is exactly minps(maxVal, val)
+                        Select(val < minVal, V(minVal), Minimum(V(maxVal), val)).Store(&out[i]);
+                    };
+                Transform<T>(x.size(), kernel, [&](std::size_t i) { out[i] = Clamp(x[i], minVal, maxVal); });
+            }
+
+            template <typename T>
+            inline void MinBatch(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept
+            {
+                assert(a.size() == out.size() && b.size() == out.size() && "Min: input and output sizes differ");
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        Minimum(V::Load(&b[i]), V::Load(&a[i])).Store(&out[i]);
+                    };
+                Transform<T>(a.size(), kernel, [&](std::size_t i) { out[i] = Min(a[i], b[i]); });
+            }
+
+            template <typename T>
+            inline void MaxBatch(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept
+            {
+                assert(a.size() == out.size() && b.size() == out.size() && "Max: input and output sizes differ");
+                auto kernel = [&](auto lanes, std::size_t i)
+                    {
+                        using V = decltype(lanes);
+                        Maximum(V::Load(&b[i]), V::Load(&a[i])).Store(&out[i]);
+                    };
+                Transform<T>(a.size(), kernel, [&](std::size_t i) { out[i] = Max(a[i], b[i]); });
+            }
+        }; // end of namespace detail
+
+    #pragma region BATCH
+        /*
+        * Batch forms of the functions in math_utils.hpp: out[i] = f(x[i]) with the same result bits as the scalar call. The input and
+        * output spans must have the same size and may be the same span. Log() returns NaN for negative inputs and -inf for zero instead
+        * of asserting, and Pow() takes one exponent for all bases. long double has no batch form (no SIMD lanes for the x87 format).
+        */
+        inline void Exp(std::span<const float> x, std::span<float> out) noexcept { detail::ExpBatch(x, out); }
+        inline void Exp(std::span<const double> x, std::span<double> out) noexcept { detail::ExpBatch(x, out); }
+
+        inline void Log(std::span<const float> x, std::span<float> out) noexcept { detail::LogBatch(x, out); }
+        inline void Log(std::span<const double> x, std::span<double> out) noexcept { detail::LogBatch(x, out); }
+
+        inline void Pow(std::span<const float> base, float exponent, std::span<float> out) noexcept { detail::PowBatch(base, exponent, out); }
+        inline void Pow(std::span<const double> base, double exponent, std::span<double> out) noexcept { detail::PowBatch(base, exponent, out); }
+
+        inline void Abs(std::span<const float> x, std::span<float> out) noexcept { detail::AbsBatch(x, out); }
+        inline void Abs(std::span<const double> x, std::span<double> out) noexcept { detail::AbsBatch(x, out); }
+
+        inline void Clamp(std::span<const float> x, float minVal, float maxVal, std::span<float> out) noexcept { detail::ClampBatch(x, minVal, maxVal, out); }
+        inline void Clamp(std::span<const double> x, double minVal, double maxVal, std::span<double> out) noexcept { detail::ClampBatch(x, minVal, maxVal, out); }
+
+        /* out[i] = Min(a[i], b[i]), pass spans: containers would select the variadic Min() */
+        inline void Min(std::span<const float> a, std::span<const float> b, std::span<float> out) noexcept { detail::MinBatch(a, b, out); }
+        inline void Min(std::span<const double> a, std::span<const double> b, std::span<double> out) noexcept { detail::MinBatch(a, b, out); }
+
+        /* out[i] = Max(a[i], b[i]), pass spans: containers would select the variadic Max() */
+        inline void Max(std::span<const float> a, std::span<const float> b, std::span<float> out) noexcept { detail::MaxBatch(a, b, out); }
+        inline void Max(std::span<const double> a, std::span<const double> b, std::span<double> out) noexcept { detail::MaxBatch(a, b, out); }
+    #pragma endregion
+    }; // end of namespace math_utils
+}; // end of namespace winxframe
+
+#if defined(__GNUC__)
+    #pragma GCC diagnostic pop
+#endif
+
+#endif
@@ -1,7 +1,7 @@
 /*!
 lib\include\utils\math_utils.hpp
 Created: October 24, 2025
-Updated: November 2, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Math Utilities header file.
@@ -12,10 +12,34 @@ Math Utilities header file.
 #ifndef MATH_UTILS_HPP_
 #define MATH_UTILS_HPP_
 
+#include <algorithm>
 #include <cmath>
 #include <cassert>
 #include <climits>
 #include <concepts>
+#include <bit>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if defined(_MSC_VER) && defined(_M_X64)
+    #include <intrin.h>
+#endif
+
+// GCC contracts a * b + c into fused multiply-adds by default (-ffp-contract=fast) once FMA is enabled, which breaks the exact error terms
+// of TwoSum() and TwoProduct() and changes how Exp(), Log() and Pow() round. The floating kernels and those entry points turn it off.
+// GCC does not inline a function with its own optimize options into other callers, so this is limited to the builds where contraction
+// can happen at all.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__FMA__)
+    #define MATH_UTILS_CONTRACT_OFF 1
+    #define MATH_UTILS_NO_CONTRACT __attribute__((optimize("fp-contract=off")))
+#else
+    #define MATH_UTILS_CONTRACT_OFF 0
+    #define MATH_UTILS_NO_CONTRACT
+#endif
 
 namespace winxframe
 {
@@ -24,6 +48,712 @@ namespace winxframe
         template <typename T>
         concept arithmetic = std::integral<T> || std::floating_point<T>;
 
+        namespace detail
+        {
+#if MATH_UTILS_CONTRACT_OFF
+    #pragma GCC push_options
+    #pragma GCC optimize("fp-contract=off")
+#endif
+            /* 80-bit x87 extended precision layout, the integer bit of the mantissa is explicit */
+            struct X87Bits
+            {
+                std::uint64_t mantissa;
+                std::uint16_t signExponent;
+                std::uint16_t padding[3];
+            };
+
+            template <typename T>
+            concept binary_float = std::floating_point<T> && std::numeric_limits<T>::radix == 2 &&
+                (std::numeric_limits<T>::digits == 24 || std::numeric_limits<T>::digits == 53 || (std::numeric_limits<T>::digits == 64 && sizeof(T) == sizeof(X87Bits)));
+
+            /* Returns 2^k for k within the normal exponent range of T */
+            template <binary_float T>
+            [[nodiscard]] constexpr T Pow2(int k) noexcept
+            {
+                if constexpr (std::numeric_limits<T>::digits == 24)
+                    return std::bit_cast<T>(static_cast<std::uint32_t>(k + 127) << 23);
+                else if constexpr (std::numeric_limits<T>::digits == 53)
+                    return std::bit_cast<T>(static_cast<std::uint64_t>(k + 1023) << 52);
+                else
+                    return std::bit_cast<T>(X87Bits{ 1ULL << 63, static_cast<std::uint16_t>(k + 16383), {} });
+            }
+
+            /* Returns m in [1, 2) with x = m * 2^e for a positive normal x, adding e to exponent */
+            template <binary_float T>
+            [[nodiscard]] constexpr T SplitExponent(T x, int& exponent) noexcept
+            {
+                if constexpr (std::numeric_limits<T>::digits == 24)
+                {
+                    const std::uint32_t bits = std::bit_cast<std::uint32_t>(x);
+                    exponent += static_cast<int>(bits >> 23) - 127;
+                    return std::bit_cast<T>((bits & 0x007FFFFFu) | 0x3F800000u);
+                }
+                else if constexpr (std::numeric_limits<T>::digits == 53)
+                {
+                    const std::uint64_t bits = std::bit_cast<std::uint64_t>(x);
+                    exponent += static_cast<int>(bits >> 52) - 1023;
+                    return std::bit_cast<T>((bits & 0x000FFFFFFFFFFFFFull) | 0x3FF0000000000000ull);
+                }
+                else
+                {
+                    X87Bits bits = std::bit_cast<X87Bits>(x);
+                    exponent += static_cast<int>(bits.signExponent & 0x7FFF) - 16383;
+                    bits.signExponent = 16383;
+                    return std::bit_cast<T>(bits);
+                }
+            }
+
+            /*
+            * The kernels below are templates over a lane type V, either a floating type or one of the SIMD register wrappers in
+            * math_batch.hpp. Both provide the arithmetic operators and Select(), Truncate(), Pow2Of() and SplitExponent(), so the batch
+            * functions run the same operations as the scalar ones and round identically. Conditions are selects rather than branches.
+            */
+            template <typename V>
+            struct LaneOf
+            {
+                using type = typename V::value_type;
+            };
+
+            template <std::floating_point T>
+            struct LaneOf<T>
+            {
+                using type = T;
+            };
+
+            template <typename V>
+            using lane_t = typename LaneOf<V>::type;
+
+            /* Returns a when the condition holds, b otherwise */
+            template <binary_float T>
+            [[nodiscard]] constexpr T Select(bool condition, T a, T b) noexcept
+            {
+                return condition ? a : b;
+            }
+
+            /* Rounds toward zero, for |x| < 2^31 */
+            template <binary_float T>
+            [[nodiscard]] constexpr T Truncate(T x) noexcept
+            {
+                return static_cast<T>(static_cast<int>(x));
+            }
+
+            /* Returns 2^k for an integral k within the normal exponent range of T */
+            template <binary_float T>
+            [[nodiscard]] constexpr T Pow2Of(T k) noexcept
+            {
+                return Pow2<T>(static_cast<int>(k));
+            }
+
+            /* Returns m in [1, 2) with x = m * 2^e for a positive normal x, adding e to exponent */
+            template <binary_float T>
+            [[nodiscard]] constexpr T SplitExponent(T x, T& exponent) noexcept
+            {
+                int e = 0;
+                const T m = SplitExponent(x, e);
+                exponent += static_cast<T>(e);
+                return m;
+            }
+
+            /* Estrin's scheme over coefficients[First, First + Count), powers[i] holds x^(2^i) */
+            template <std::size_t First, std::size_t Count, typename V, typename T, std::size_t N, std::size_t P>
+            [[nodiscard]] constexpr V Estrin(const T(&coefficients)[N], const V(&powers)[P]) noexcept
+            {
+                if constexpr (Count == 1)
+                    return V(coefficients[First]);
+                else
+                {
+                    constexpr std::size_t lowCount = std::bit_floor(Count - 1);
+                    return Estrin<First, lowCount>(coefficients, powers) + powers[std::countr_zero(lowCount)] * Estrin<First + lowCount, Count - lowCount>(coefficients, powers);
+                }
+            }
+
+            /*
+            * Evaluates c[0] + c[1] * x + ... + c[N - 1] * x^(N - 1). Estrin's scheme splits the sum into halves joined by a power of x, so the
+            * dependency chain is about log2(N) multiply-adds long instead of the N of Horner's scheme.
+            */
+            template <typename V, typename T, std::size_t N>
+            [[nodiscard]] constexpr V Polynomial(V x, const T(&coefficients)[N]) noexcept
+            {
+                constexpr std::size_t powerCount = std::bit_width(N);
+                V powers[powerCount]{ x };
+                for (std::size_t i = 1; i < powerCount; ++i)
+                    powers[i] = powers[i - 1] * powers[i - 1];
+                return Estrin<0, N>(coefficients, powers);
+            }
+
+            /*
+            * Constants of Exp() and Log() per precision. ln2Hi has few enough significant bits that k * ln2Hi is exact for every k reached,
+            * ln2Lo = ln(2) - ln2Hi. expCoefficients approximate (e^r - 1 - r) / r^2 on |r| <= ln(2) / 2, and logCoefficients approximate
+            * (2 * atanh(s) / s - 2) / s^2 on s^2 <= 0.02944, both minimax in relative error (Remez exchange). logTailCoefficients approximate
+            * ((2 * atanh(s) / s - 2) / s^2 - 2/3) / s^2 one order further, for the extended precision logarithm of Pow().
+            */
+            template <binary_float T, int Digits = std::numeric_limits<T>::digits>
+            struct ExpLogKernel;
+
+            template <binary_float T>
+            struct ExpLogKernel<T, 24>
+            {
+                static constexpr T maxExp = static_cast<T>(88.72283911167299960540571L);   // 128 * ln(2)
+                static constexpr T minExp = static_cast<T>(-103.9720770839917964125848L);  // -150 * ln(2)
+                static constexpr T log2E = static_cast<T>(1.442695040888963407359925L);
+                static constexpr T ln2Hi = static_cast<T>(0.693145751953125L);
+                static constexpr T ln2Lo = static_cast<T>(1.428606820309417232121458e-6L);
+                static constexpr T sqrt2 = static_cast<T>(1.414213562373095048801689L);
+                static constexpr T expCoefficients[] = {
+                    static_cast<T>(0.49999999554L), static_cast<T>(0.16666577463L), static_cast<T>(0.041666853043L), static_cast<T>(0.0083631165237L),
+                    static_cast<T>(0.0013901275445L)
+                };
+                static constexpr T logCoefficients[] = {
+                    static_cast<T>(0.66666685161L), static_cast<T>(0.39988758079L), static_cast<T>(0.29580611733L)
+                };
+                static constexpr T logTailCoefficients[] = {
+                    static_cast<T>(0.40000122253885110127233L), static_cast<T>(0.28550789367365820664832L), static_cast<T>(0.23331104377373694900484L)
+                };
+            };
+
+            template <binary_float T>
+            struct ExpLogKernel<T, 53>
+            {
+                static constexpr T maxExp = static_cast<T>(709.7827128933839968432457L);   // 1024 * ln(2)
+                static constexpr T minExp = static_cast<T>(-745.1332191019412076235245L);  // -1075 * ln(2)
+                static constexpr T log2E = static_cast<T>(1.442695040888963407359925L);
+                static constexpr T ln2Hi = static_cast<T>(0.693147180559890330187045037746L);
+                static constexpr T ln2Lo = static_cast<T>(5.497923018708371174712472e-14L);
+                static constexpr T sqrt2 = static_cast<T>(1.414213562373095048801689L);
+                static constexpr T expCoefficients[] = {
+                    static_cast<T>(0.500000000000000101L), static_cast<T>(0.1666666666666664405L), static_cast<T>(0.04166666666662447913L),
+                    static_cast<T>(0.008333333333356107063L), static_cast<T>(0.001388888891705315044L), static_cast<T>(0.0001984126978483686646L),
+                    static_cast<T>(0.00002480152152891552078L), static_cast<T>(2.75573554367970679e-6L), static_cast<T>(2.761998354438103271e-7L),
+                    static_cast<T>(2.506815110558107584e-8L)
+                };
+                static constexpr T logCoefficients[] = {
+                    static_cast<T>(0.6666666666666669765L), static_cast<T>(0.3999999999989861041L), static_cast<T>(0.2857142862624302248L),
+                    static_cast<T>(0.2222221110183514335L), static_cast<T>(0.1818289105106194399L), static_cast<T>(0.1533166847847809698L),
+                    static_cast<T>(0.1461700658595921111L)
+                };
+                static constexpr T logTailCoefficients[] = {
+                    static_cast<T>(0.39999999999999992396227L), static_cast<T>(0.2857142857143541261374L), static_cast<T>(0.22222222219846761689721L),
+                    static_cast<T>(0.18181818595052526905468L), static_cast<T>(0.15384575041197888246038L), static_cast<T>(0.13335642026362204318371L),
+                    static_cast<T>(0.11688058536550893805271L), static_cast<T>(0.11882514036355572798537L)
+                };
+            };
+
+            template <binary_float T>
+            struct ExpLogKernel<T, 64>
+            {
+                static constexpr T maxExp = static_cast<T>(11356.52340629414394949193L);   // 16384 * ln(2)
+                static constexpr T minExp = static_cast<T>(-11399.4985314888605586758L);   // -16446 * ln(2)
+                static constexpr T log2E = static_cast<T>(1.442695040888963407359925L);
+                static constexpr T ln2Hi = static_cast<T>(0.69314718055994362089222704526L);
+                static constexpr T ln2Lo = static_cast<T>(1.688525005076197806790396e-15L);
+                static constexpr T sqrt2 = static_cast<T>(1.414213562373095048801689L);
+                static constexpr T expCoefficients[] = {
+                    static_cast<T>(0.49999999999999999998335L), static_cast<T>(0.16666666666666666671457L), static_cast<T>(0.041666666666666676674903L),
+                    static_cast<T>(0.0083333333333333258249244L), static_cast<T>(0.0013888888888879145622902L), static_cast<T>(0.00019841269841301517822195L),
+                    static_cast<T>(0.000024801587336262011744877L), static_cast<T>(0.0000027557319174368390113784L), static_cast<T>(2.755726346316027054961e-7L),
+                    static_cast<T>(2.5052131838810746738447e-8L), static_cast<T>(2.091807225015630664324e-9L), static_cast<T>(1.606821136703400342958e-10L)
+                };
+                static constexpr T logCoefficients[] = {
+                    static_cast<T>(0.66666666666666666668087L), static_cast<T>(0.39999999999999992396227L), static_cast<T>(0.2857142857143541261374L),
+                    static_cast<T>(0.22222222219846761689721L), static_cast<T>(0.18181818595052526905468L), static_cast<T>(0.15384575041197888246038L),
+                    static_cast<T>(0.13335642026362204318371L), static_cast<T>(0.11688058536550893805271L), static_cast<T>(0.11882514036355572798537L)
+                };
+                static constexpr T logTailCoefficients[] = {
+                    static_cast<T>(0.39999999999999999999465L), static_cast<T>(0.28571428571428572149527L), static_cast<T>(0.22222222222221842047411L),
+                    static_cast<T>(0.18181818181921093561363L), static_cast<T>(0.15384615368365153416552L), static_cast<T>(0.13333334931852808829089L),
+                    static_cast<T>(0.11764605046784536329018L), static_cast<T>(0.10530390642321777631772L), static_cast<T>(0.094221324091839430033713L),
+                    static_cast<T>(0.10109179043360332530477L)
+                };
+            };
+
+            /* hi + lo = a + b exactly, hi being the rounded sum (Knuth) */
+            template <typename V>
+            constexpr void TwoSum(V a, V b, V& hi, V& lo) noexcept
+            {
+                hi = a + b;
+                const V bVirtual = hi - a;
+                lo = (a - (hi - bVirtual)) + (b - bVirtual);
+            }
+
+            /* hi + lo = a * b exactly, hi being the rounded product (Dekker, with Veltkamp splitting since std::fma is not constexpr) */
+            template <typename V>
+            constexpr void TwoProduct(V a, V b, V& hi, V& lo) noexcept
+            {
+                using T = lane_t<V>;
+                constexpr T splitter = static_cast<T>((1ULL << ((std::numeric_limits<T>::digits + 1) / 2)) + 1);
+                const V aScaled = a * splitter, bScaled = b * splitter;
+                const V aHi = aScaled - (aScaled - a), bHi = bScaled - (bScaled - b);
+                const V aLo = a - aHi, bLo = b - bHi;
+                hi = a * b;
+                lo = ((aHi * bHi - hi) + aHi * bLo + aLo * bHi) + aLo * bLo;
+            }
+
+            /* Returns true when the sign bit of x is set, including -0 (std::signbit is not constexpr) */
+            template <binary_float T>
+            [[nodiscard]] constexpr bool SignBit(T x) noexcept
+            {
+                if constexpr (std::numeric_limits<T>::digits == 24)
+                    return (std::bit_cast<std::uint32_t>(x) >> 31) != 0;
+                else if constexpr (std::numeric_limits<T>::digits == 53)
+                    return (std::bit_cast<std::uint64_t>(x) >> 63) != 0;
+                else
+                    return (std::bit_cast<X87Bits>(x).signExponent >> 15) != 0;
+            }
+
+            /* Scales a positive finite hi + lo by the power of two that brings hi into [1, 2), adding that power to exponent */
+            template <typename V>
+            constexpr V Renormalize(V hi, V& lo, V& exponent) noexcept
+            {
+                V shift = V(static_cast<lane_t<V>>(0));
+                const V m = SplitExponent(hi, shift);
+                lo = lo * Pow2Of(-shift);
+                exponent = exponent + shift;
+                return m;
+            }
+
+            /*
+            * x * 2^k for x in [1 / 2, 2] and an integral k, rounded once. k is clamped to about twice the normal exponent range, which
+            * already overflows or underflows any such x, and applied in two halves so that x * 2^(k / 2) is still normal.
+            */
+            template <typename V>
+            constexpr V ScaleByPow2(V x, V k) noexcept
+            {
+                using T = lane_t<V>;
+                constexpr T lowest = static_cast<T>(2 * std::numeric_limits<T>::min_exponent);
+                constexpr T highest = static_cast<T>(2 * (std::numeric_limits<T>::max_exponent - 1));
+                k = Select(k < lowest, V(lowest), Select(k > highest, V(highest), k));
+                const V halfK = Truncate(k * static_cast<T>(0.5));
+                return x * Pow2Of(halfK) * Pow2Of(k - halfK);
+            }
+
+            /*
+            * (hi + lo) * 2^exponent = base^n by squaring for a positive finite base, with the rounding error of every product carried in
+            * lo. The running product and square are renormalised to [1, 2) after every step with their binary exponents kept apart, so
+            * TwoProduct() never overflows however large or small base^n is. lo is 0 when base^n is exact in T.
+            */
+            template <typename V>
+            constexpr V PowUnsigned(V base, unsigned int n, V& lo, V& exponent) noexcept
+            {
+                using T = lane_t<V>;
+                constexpr int digits = std::numeric_limits<T>::digits;
+                // subnormal bases are scaled into the normal range first, SplitExponent() reads the exponent field
+                const auto isSubnormal = base < std::numeric_limits<T>::min();
+                V squareExponent = Select(isSubnormal, V(static_cast<T>(-digits)), V(static_cast<T>(0)));
+                V square = SplitExponent(base * Select(isSubnormal, V(Pow2<T>(digits)), V(static_cast<T>(1))), squareExponent);
+                V squareLo = V(static_cast<T>(0)), hi = V(static_cast<T>(1));
+                lo = V(static_cast<T>(0));
+                exponent = V(static_cast<T>(0));
+                while (n > 0)
+                {
+                    if (n & 1)
+                    {
+                        V productHi, productLo;
+                        TwoProduct(hi, square, productHi, productLo);
+                        lo = productLo + (hi * squareLo + lo * square);
+                        exponent = exponent + squareExponent;
+                        hi = Renormalize(productHi, lo, exponent);
+                    }
+                    n >>= 1;
+                    if (n)
+                    {
+                        V productHi, productLo;
+                        TwoProduct(square, square, productHi, productLo);
+                        squareLo = productLo + static_cast<T>(2) * square * squareLo;
+                        squareExponent = squareExponent + squareExponent;
+                        square = Renormalize(productHi, squareLo, squareExponent);
+                    }
+                }
+                return hi;
+            }
+
+            /* base^exponent by squaring, see Pow(T, E) */
+            template <typename V>
+            constexpr V PowIntegral(V base, int exponent) noexcept
+            {
+                using T = lane_t<V>;
+                // the square is correctly rounded as it is
+                if (exponent == 2)
+                    return base * base;
+                if (exponent == 0)
+                    return V(static_cast<T>(1));
+
+                // |exponent| as unsigned so that INT_MIN does not overflow
+                const unsigned int n = exponent < 0 ? 0u - static_cast<unsigned int>(exponent) : static_cast<unsigned int>(exponent);
+                const bool isOdd = (n & 1) != 0;
+                const V magnitude = Select(base < static_cast<T>(0), -base, base);
+                const auto isFinite = (magnitude > static_cast<T>(0)) & (magnitude <= std::numeric_limits<T>::max());
+                V lo, scale;
+                const V hi = PowUnsigned(Select(isFinite, magnitude, V(static_cast<T>(1))), n, lo, scale);
+                V result = hi + lo;
+                if (exponent < 0)
+                {
+                    // 1 / (hi + lo) refined by its residual, hi being in [1, 2) neither factor of TwoProduct() can overflow
+                    const V quotient = static_cast<T>(1) / hi;
+                    V productHi, productLo;
+                    TwoProduct(hi, quotient, productHi, productLo);
+                    result = quotient + quotient * (((static_cast<T>(1) - productHi) - productLo) - lo * quotient);
+                    scale = -scale;
+                }
+                result = ScaleByPow2(result, scale);
+                if (isOdd)
+                    result = Select(base < static_cast<T>(0), -result, result);
+
+                // zero, infinite and NaN bases are their own odd powers, so the sign of -0 and -infinity is kept
+                V special = isOdd ? base : base * base;
+                if (exponent < 0)
+                    special = static_cast<T>(1) / special;
+                return Select(isFinite, result, special);
+            }
+
+            /* Returns 0 when a finite y is not an integer, 1 when it is odd and 2 when it is even */
+            template <binary_float T>
+            [[nodiscard]] constexpr int IntegerParity(T y) noexcept
+            {
+                const T magnitude = y < static_cast<T>(0) ? -y : y;
+                if (magnitude >= Pow2<T>(std::numeric_limits<T>::digits))
+                    return 2;
+                const std::uint64_t integral = static_cast<std::uint64_t>(magnitude);
+                if (static_cast<T>(integral) != magnitude)
+                    return 0;
+                return (integral & 1) ? 1 : 2;
+            }
+
+            /* e^(x + tail) for x within [minExp, maxExp] and |tail| <= ulp(x), the range reduction of Exp() */
+            template <typename V>
+            [[nodiscard]] constexpr V ExpReduced(V x, V tail) noexcept
+            {
+                using T = lane_t<V>;
+                using kernel = ExpLogKernel<T>;
+                const V k = Truncate(x * kernel::log2E + Select(x < static_cast<T>(0), V(static_cast<T>(-0.5)), V(static_cast<T>(0.5))));
+                const V hi = x - k * kernel::ln2Hi;
+                const V lo = k * kernel::ln2Lo - tail;
+                const V r = hi - lo;
+
+                // 1 + hi is summed exactly so that only the final addition rounds, e^r - 1 - r is small enough to absorb the rest
+                V sumHi, sumLo;
+                TwoSum(V(static_cast<T>(1)), hi, sumHi, sumLo);
+                const V expR = sumHi + (sumLo + (r * r * Polynomial(r, kernel::expCoefficients) - lo));
+
+                // two steps so that neither factor leaves the normal range, the second multiplication rounds subnormal results once
+                const V halfK = Truncate(k * static_cast<T>(0.5));
+                return expR * Pow2Of(halfK) * Pow2Of(k - halfK);
+            }
+
+            /* Returns m in [sqrt(2) / 2, sqrt(2)) with x = m * 2^e for a positive finite x, subnormal inputs are scaled into the normal range first */
+            template <typename V>
+            [[nodiscard]] constexpr V ReduceLogArgument(V x, V& e) noexcept
+            {
+                using T = lane_t<V>;
+                using kernel = ExpLogKernel<T>;
+                constexpr int digits = std::numeric_limits<T>::digits;
+                const auto isSubnormal = x < std::numeric_limits<T>::min();
+                e = Select(isSubnormal, V(static_cast<T>(-digits)), V(static_cast<T>(0)));
+                V m = SplitExponent(x * Select(isSubnormal, V(Pow2<T>(digits)), V(static_cast<T>(1))), e);
+                const auto isAboveSqrt2 = m > kernel::sqrt2;
+                e = Select(isAboveSqrt2, e + static_cast<T>(1), e);
+                return Select(isAboveSqrt2, m * static_cast<T>(0.5), m);
+            }
+
+            /* ln(x) for a positive finite x, see Log() */
+            template <typename V>
+            [[nodiscard]] constexpr V LogReduced(V x) noexcept
+            {
+                using T = lane_t<V>;
+                using kernel = ExpLogKernel<T>;
+                V k;
+                const V m = ReduceLogArgument(x, k);
+
+                // ln(1 + f) = f - f^2 / 2 + s * (f^2 / 2 + R), keeping the large terms exact
+                const V f = m - static_cast<T>(1);
+                const V s = f / (static_cast<T>(2) + f);
+                const V z = s * s;
+                const V R = z * Polynomial(z, kernel::logCoefficients);
+                const V halfSquareF = static_cast<T>(0.5) * f * f;
+                return k * kernel::ln2Hi - ((halfSquareF - (s * (halfSquareF + R) + k * kernel::ln2Lo)) - f);
+            }
+
+            /*
+            * hi + lo = ln(x) for a positive finite x, to about twice the precision of T. Same reduction as Log(), but s = f / (2 + f) and the
+            * 2s + 2/3 * s^3 terms of 2 * atanh(s) are carried as unevaluated sums, so that y * ln(x) in Pow() keeps its low bits.
+            */
+            template <typename V>
+            constexpr void LogExtended(V x, V& hi, V& lo) noexcept
+            {
+                using T = lane_t<V>;
+                using kernel = ExpLogKernel<T>;
+                V k;
+                const V m = ReduceLogArgument(x, k);
+
+                // s = f / d with d = 2 + f = dHi + dLo, the residual f - sHi * d gives sLo (one division, the residuals absorb the rest)
+                const V f = m - static_cast<T>(1);
+                const V dHi = static_cast<T>(2) + f;
+                const V dLo = f - (dHi - static_cast<T>(2));
+                const V reciprocal = static_cast<T>(1) / dHi;
+                const V sHi = f * reciprocal;
+                V productHi, productLo;
+                TwoProduct(sHi, dHi, productHi, productLo);
+                const V sLo = (((f - productHi) - productLo) - sHi * dLo) * reciprocal;
+
+                // s^3 / 3 as thirdHi + thirdLo, its rounding error would otherwise be amplified by y in y * ln(x)
+                V squareHi, squareLo, cubeHi, cubeLo;
+                TwoProduct(sHi, sHi, squareHi, squareLo);
+                squareLo = squareLo + static_cast<T>(2) * sHi * sLo;
+                TwoProduct(squareHi, sHi, cubeHi, cubeLo);
+                cubeLo = cubeLo + (squareLo * sHi + squareHi * sLo);
+                constexpr T third = static_cast<T>(1) / static_cast<T>(3);
+                const V thirdHi = cubeHi * third;
+                TwoProduct(thirdHi, V(static_cast<T>(3)), productHi, productLo);
+                const V thirdLo = (((cubeHi - productHi) - productLo) + cubeLo) * third;
+
+                // 2 * atanh(s) = 2s + 2/3 * s^3 + s^5 * Q(z) with z = s^2, the last term is below 2e-4 of the result
+                const V z = squareHi;
+                const V tail = cubeHi * z * Polynomial(z, kernel::logTailCoefficients);
+                V sumHi, sumLo;
+                TwoSum(static_cast<T>(2) * sHi, static_cast<T>(2) * thirdHi, sumHi, sumLo);
+                sumLo = sumLo + (static_cast<T>(2) * (sLo + thirdLo) + tail);
+
+                TwoSum(k * kernel::ln2Hi, sumHi, hi, lo);
+                lo = lo + (sumLo + k * kernel::ln2Lo);
+                const V renormalized = hi + lo;
+                lo = lo - (renormalized - hi);
+                hi = renormalized;
+            }
+
+            /* Log() without the domain assert: NaN for negative inputs, -inf for zero */
+            template <binary_float T>
+            [[nodiscard]] MATH_UTILS_NO_CONTRACT constexpr T LogUnchecked(T x) noexcept
+            {
+                if (x != x)
+                    return x;
+                if (x < static_cast<T>(0)) return std::numeric_limits<T>::quiet_NaN();
+                if (x == static_cast<T>(0)) return -std::numeric_limits<T>::infinity();
+                if (x == std::numeric_limits<T>::infinity()) return x;
+                return LogReduced(x);
+            }
+#if MATH_UTILS_CONTRACT_OFF
+    #pragma GCC pop_options
+#endif
+
+            /* Returns the low half of the 128-bit product a * b and stores the high half in high */
+            [[nodiscard]] constexpr std::uint64_t MulWide(std::uint64_t a, std::uint64_t b, std::uint64_t& high) noexcept
+            {
+#if defined(__SIZEOF_INT128__)
+                const unsigned __int128 product = static_cast<unsigned __int128>(a) * b;
+                high = static_cast<std::uint64_t>(product >> 64);
+                return static_cast<std::uint64_t>(product);
+#else
+    #if defined(_MSC_VER) && defined(_M_X64)
+                if (!std::is_constant_evaluated())
+                    return _umul128(a, b, &high);
+    #endif
+                // four 32 x 32 bit partial products, the middle column collects the carries into the high half
+                const std::uint64_t aLo = a & 0xFFFFFFFFULL, aHi = a >> 32;
+                const std::uint64_t bLo = b & 0xFFFFFFFFULL, bHi = b >> 32;
+                const std::uint64_t lowLow = aLo * bLo, lowHigh = aLo * bHi, highLow = aHi * bLo;
+                const std::uint64_t middle = (lowLow >> 32) + (lowHigh & 0xFFFFFFFFULL) + (highLow & 0xFFFFFFFFULL);
+                high = aHi * bHi + (lowHigh >> 32) + (highLow >> 32) + (middle >> 32);
+                return (middle << 32) | (lowLow & 0xFFFFFFFFULL);
+#endif
+            }
+
+            /* Returns (high * 2^64 + low) % m for high < m */
+            [[nodiscard]] constexpr std::uint64_t Mod128(std::uint64_t high, std::uint64_t low, std::uint64_t m) noexcept
+            {
+#if defined(__SIZEOF_INT128__)
+                return static_cast<std::uint64_t>(((static_cast<unsigned __int128>(high) << 64) | low) % m);
+#else
+    #if defined(_MSC_VER) && defined(_M_X64)
+                if (!std::is_constant_evaluated())
+                {
+                    std::uint64_t remainder = 0;
+                    static_cast<void>(_udiv128(high, low, m, &remainder));
+                    return remainder;
+                }
+    #endif
+                // restoring division one bit at a time, the bit shifted out of remainder is kept in carry
+                std::uint64_t remainder = high;
+                for (int bit = 63; bit >= 0; --bit)
+                {
+                    const bool carry = (remainder >> 63) != 0;
+                    remainder = (remainder << 1) | ((low >> bit) & 1);
+                    if (carry || remainder >= m)
+                        remainder -= m;
+                }
+                return remainder;
+#endif
+            }
+
+            /* Returns (high * 2^64 + low) / d for high < d and stores the remainder */
+            [[nodiscard]] constexpr std::uint64_t Div128(std::uint64_t high, std::uint64_t low, std::uint64_t d, std::uint64_t& remainder) noexcept
+            {
+#if defined(__SIZEOF_INT128__)
+                const unsigned __int128 dividend = (static_cast<unsigned __int128>(high) << 64) | low;
+                remainder = static_cast<std::uint64_t>(dividend % d);
+                return static_cast<std::uint64_t>(dividend / d);
+#else
+    #if defined(_MSC_VER) && defined(_M_X64)
+                if (!std::is_constant_evaluated())
+                    return _udiv128(high, low, d, &remainder);
+    #endif
+                // the restoring division of Mod128(), keeping the quotient bits
+                std::uint64_t quotient = 0;
+                remainder = high;
+                for (int bit = 63; bit >= 0; --bit)
+                {
+                    const bool carry = (remainder >> 63) != 0;
+                    remainder = (remainder << 1) | ((low >> bit) & 1);
+                    quotient <<= 1;
+                    if (carry || remainder >= d)
+                    {
+                        remainder -= d;
+                        quotient |= 1;
+                    }
+                }
+                return quotient;
+#endif
+            }
+
+            /* Returns a^-1 mod m for gcd(a, m) == 1 by the extended Euclidean algorithm on unsigned magnitudes, the Bezout coefficients alternate in sign */
+            [[nodiscard]] constexpr std::uint64_t InverseMod(std::uint64_t a, std::uint64_t m) noexcept
+            {
+                if (m == 1)
+                    return 0;
+                std::uint64_t remainder = m, nextRemainder = a % m;
+                std::uint64_t coefficient = 0, nextCoefficient = 1;
+                bool isPositive = true;
+                while (nextRemainder > 1)
+                {
+                    const std::uint64_t quotient = remainder / nextRemainder;
+                    const std::uint64_t newRemainder = remainder - quotient * nextRemainder;
+                    const std::uint64_t newCoefficient = coefficient + quotient * nextCoefficient;
+                    remainder = nextRemainder;
+                    nextRemainder = newRemainder;
+                    coefficient = nextCoefficient;
+                    nextCoefficient = newCoefficient;
+                    isPositive = !isPositive;
+                }
+                assert(nextRemainder == 1 && "InverseMod: inverse does not exist when GCD(a, m) != 1");
+                return isPositive ? nextCoefficient : m - nextCoefficient;
+            }
+
+            /*
+            * F(n) by fast doubling over the bits of n, from (F(k), F(k + 1)) to F(2k) = F(k) * (2 * F(k + 1) - F(k)) and F(2k + 1) = F(k)^2 + F(k + 1)^2.
+            * The last bit computes F(n) alone, so nothing beyond F(n) is formed. zero and one are F(0) and F(1) in the representation of add, sub and mul.
+            */
+            template <typename T, typename Add, typename Sub, typename Mul>
+            [[nodiscard]] constexpr T FibonacciDoubling(unsigned long long n, const T& zero, const T& one, Add add, Sub sub, Mul mul)
+            {
+                if (n == 0) return zero;
+                T a = zero, b = one;
+                for (int bit = std::bit_width(n) - 1; bit > 0; --bit)
+                {
+                    T even = mul(a, sub(add(b, b), a));
+                    T odd = add(mul(a, a), mul(b, b));
+                    if ((n >> bit) & 1)
+                    {
+                        b = add(even, odd);
+                        a = std::move(odd);
+                    }
+                    else
+                    {
+                        a = std::move(even);
+                        b = std::move(odd);
+                    }
+                }
+                return (n & 1) ? add(mul(a, a), mul(b, b)) : mul(a, sub(add(b, b), a));
+            }
+
+            /* |value| as the unsigned type of T, also for the minimum of signed types */
+            template <std::integral T>
+            [[nodiscard]] constexpr std::make_unsigned_t<T> Magnitude(T value) noexcept
+            {
+                using U = std::make_unsigned_t<T>;
+                if constexpr (std::is_signed_v<T>)
+                    return value < 0 ? static_cast<U>(U(0) - static_cast<U>(value)) : static_cast<U>(value);
+                else
+                    return value;
+            }
+
+            /* Stein's binary GCD, GCD(a, 0) = a */
+            template <std::unsigned_integral U>
+            [[nodiscard]] constexpr U BinaryGCD(U a, U b) noexcept
+            {
+                if (a == 0) return b;
+                if (b == 0) return a;
+                // GCD(2^i * a', 2^j * b') = 2^min(i, j) * GCD(a', b') for odd a', b'
+                const int shift = std::countr_zero(static_cast<U>(a | b));
+                a >>= std::countr_zero(a);
+                b >>= std::countr_zero(b);
+                while (a != b)
+                {
+                    // both odd: GCD(a, b) = GCD(min(a, b), |a - b|) and the difference is even
+                    const U difference = a > b ? static_cast<U>(a - b) : static_cast<U>(b - a);
+                    a = a < b ? a : b;
+                    b = static_cast<U>(difference >> std::countr_zero(difference));
+                }
+                return static_cast<U>(a << shift);
+            }
+
+            /* product = a * b, returns true when the product does not fit in U */
+            template <std::unsigned_integral U>
+            [[nodiscard]] constexpr bool MulOverflow(U a, U b, U& product) noexcept
+            {
+                if constexpr (sizeof(U) < sizeof(std::uint64_t))
+                {
+                    const std::uint64_t wide = static_cast<std::uint64_t>(a) * b;
+                    product = static_cast<U>(wide);
+                    return wide > std::numeric_limits<U>::max();
+                }
+                else
+                {
+                    std::uint64_t high = 0;
+                    product = static_cast<U>(MulWide(a, b, high));
+                    return high != 0;
+                }
+            }
+
+            /* lo * (lo + 1) * ... * (hi - 1) for lo < hi, halves of the range multiplied recursively */
+            template <typename T>
+            [[nodiscard]] constexpr T RangeProduct(unsigned long long lo, unsigned long long hi)
+            {
+                if (hi - lo <= 16)
+                {
+                    T product = T(lo);
+                    for (unsigned long long i = lo + 1; i < hi; ++i)
+                        product = T(product * T(i));
+                    return product;
+                }
+                const unsigned long long middle = lo + (hi - lo) / 2;
+                return T(RangeProduct<T>(lo, middle) * RangeProduct<T>(middle, hi));
+            }
+
+            /* Largest n with n! representable in T */
+            template <std::integral T>
+            [[nodiscard]] consteval int FactorialLimit() noexcept
+            {
+                T factorial = 1;
+                int n = 1;
+                while (factorial <= std::numeric_limits<T>::max() / (n + 1))
+                    factorial *= static_cast<T>(++n);
+                return n;
+            }
+
+            /* Largest n with F(n) representable in T */
+            template <std::integral T>
+            [[nodiscard]] consteval int FibonacciLimit() noexcept
+            {
+                T a = 0, b = 1;
+                int n = 1;
+                while (b <= std::numeric_limits<T>::max() - a)
+                {
+                    b += a;
+                    a = b - a;
+                    ++n;
+                }
+                return n;
+            }
+        }; // end of namespace detail
+
     #pragma region MATHEMATICAL HELPERS
         /* Replace the value of an object with a new value and return the object's original value */
         template <typename T, typename U = T>
@@ -61,75 +791,42 @@ namespace winxframe
                 return r;
         }
 
-        /* Calculates e^x (the base-e exponential), where e approx. 2.7182818 */
+        /*
+        * Calculates e^x (the base-e exponential), where e approx. 2.7182818
+        * x is split into k * ln(2) + r with |r| <= ln(2) / 2 (ln(2) held as a high part exact in k * ln(2) plus a low part), e^r is a
+        * fixed degree minimax polynomial, and the result is scaled by 2^k through the exponent bits, so the cost does not depend on x.
+        * 1 + hi (r less its low part) is summed exactly before the polynomial is added, so the result is rounded essentially once.
+        * Error: below 1 ULP for float, double, and the 64-bit long double (measured at most 0.81 ULP against the exact value, see
+        * math_accuracy.cpp), subnormal results included.
+        */
         template<std::floating_point T>
-        [[nodiscard]] constexpr T Exp(T x) noexcept
+        [[nodiscard]] MATH_UTILS_NO_CONTRACT constexpr T Exp(T x) noexcept
         {
-            constexpr T maxExp = std::is_same_v<T, float> ? 88.722839f : std::is_same_v<T, long double> ? 11356.523406841f : 709.782712893384;
-            constexpr T minExp = std::is_same_v<T, float> ? -103.27893f : std::is_same_v<T, long double> ? -11392.0L : -745.133219101941;
-
-            if (x >= maxExp)
+            using kernel = detail::ExpLogKernel<T>;
+            if (x != x)
+                return x;
+            if (x > kernel::maxExp)
                 return std::numeric_limits<T>::infinity();
-            if (x <= minExp)
+            if (x < kernel::minExp)
                 return static_cast<T>(0);
+            // e^x rounds to 1 + x, returned early since r * r would otherwise underflow into slow subnormal arithmetic
+            if (Abs(x) < std::numeric_limits<T>::epsilon())
+                return static_cast<T>(1) + x;
 
-            T term = static_cast<T>(1);
-            T sum = static_cast<T>(1);
-
-            for (int n = 1; n < 100; ++n)
-            {
-                term *= x / static_cast<T>(n);
-                sum += term;
-
-                if (term < static_cast<T>(1e-12) && term > static_cast<T>(-1e-12))
-                    break;
-            }
-
-            return sum;
+            return detail::ExpReduced(x, static_cast<T>(0));
         }
 
-        /* Computes the natural logarithm (ln (x)), which is the inverse of the exponential function e^x */
+        /*
+        * Computes the natural logarithm (ln (x)), which is the inverse of the exponential function e^x
+        * x is split into m * 2^e with m in [sqrt(2) / 2, sqrt(2)) through the exponent bits, then ln(m) = 2 * atanh(s) with s = (m - 1) / (m + 1)
+        * and |s| <= 0.1716, evaluated as a fixed degree minimax polynomial in s^2. The cost does not depend on x.
+        * Error: below 1 ULP for float, double, and the 64-bit long double (see math_accuracy.cpp).
+        */
         template<std::floating_point T>
-        [[nodiscard]] constexpr T Log(T x) noexcept
+        [[nodiscard]] MATH_UTILS_NO_CONTRACT constexpr T Log(T x) noexcept
         {
             assert(x > static_cast<T>(0) && "Log: input must be positive");
-            if (x == static_cast<T>(1)) return static_cast<T>(0);
-            if (x == static_cast<T>(0)) return -std::numeric_limits<T>::infinity();
-            if (x < static_cast<T>(0)) return std::numeric_limits<T>::quiet_NaN();
-
-            // range reduction, bring x into [0.5, 2]
-            int k = 0;
-            while (x > static_cast<T>(2))
-            {
-                x /= static_cast<T>(2); ++k;
-            }
-            while (x < static_cast<T>(0.5))
-            {
-                x *= static_cast<T>(2); --k;
-            }
-
-            // series expansion for ln(1 + y)
-            T y = x - static_cast<T>(1);
-            T term = y;
-            T sum = y;
-
-            for (int n = 2; n < 100; ++n)
-            {
-                term *= -y;
-                T add = term / static_cast<T>(n);
-                sum += add;
-
-                if (add < static_cast<T>(1e-12) && add > static_cast<T>(-1e-12))
-                    break;
-            }
-
-            // precomputed ln(2) constants
-            constexpr T LN2 = std::is_same_v<T, float> ? static_cast<T>(0.6931471805599453f) :
-                std::is_same_v<T, long double> ? static_cast<T>(0.693147180559945309417232121458176568L) :
-                static_cast<T>(0.69314718055994530942);
-
-            // adjust for power of two normalization
-            return sum + static_cast<T>(k) * LN2;
+            return detail::LogUnchecked(x);
         }
 
         /* Calculates floor(a / b), i.e., the largest integer <= a / b */
@@ -150,15 +847,30 @@ namespace winxframe
     #pragma endregion
 
     #pragma region GREATEST COMMON DIVISOR
-        /* Calculates the largest positive integer that divides two or more integers without leaving a remainder */
+        /*
+        * Calculates the largest positive integer that divides two or more integers without leaving a remainder.
+        * Binary (Stein's) algorithm on the magnitudes: factors of two are removed with std::countr_zero and the odd values replaced by
+        * their difference, so each step is a subtraction and a shift instead of a division.
+        */
         template <std::integral T>
         [[nodiscard]] constexpr T GCD(T a, T b) noexcept
         {
-            while (b != 0) b = Exchange(a, b) % b;
-            if constexpr (std::is_signed_v<T>)
-                return a < 0 ? -a : a;
-            else
-                return a;
+            return static_cast<T>(detail::BinaryGCD(detail::Magnitude(a), detail::Magnitude(b)));
+        }
+
+        /* GCD of every value, 0 for none; stops at the first partial result of 1 */
+        template <typename T, std::size_t Extent>
+            requires std::integral<std::remove_const_t<T>>
+        [[nodiscard]] constexpr std::remove_const_t<T> GCD(std::span<T, Extent> values) noexcept
+        {
+            using U = std::make_unsigned_t<std::remove_const_t<T>>;
+            U result = 0;
+            for (const auto value : values)
+            {
+                result = detail::BinaryGCD(result, detail::Magnitude(value));
+                if (result == 1) break;
+            }
+            return static_cast<std::remove_const_t<T>>(result);
         }
     #pragma endregion
 
@@ -168,11 +880,27 @@ namespace winxframe
         [[nodiscard]] constexpr T LCM(T a, T b) noexcept
         {
             if (a == 0 || b == 0) return 0;
-            T g = GCD(a, b);
-            T absA = Abs(a);
-            T absB = Abs(b);
-            assert(absA / g <= std::numeric_limits<T>::max() / absB && "LCM: Integer overflow, (absA / g) * absB would exceed max value for type T");
-            return (absA / g) * absB;
+            using U = std::make_unsigned_t<T>;
+            const U absA = detail::Magnitude(a), absB = detail::Magnitude(b);
+            U product = 0;
+            // the overflow check multiplies in a wider type instead of dividing max by absB
+            [[maybe_unused]] const bool isOverflow = detail::MulOverflow(static_cast<U>(absA / detail::BinaryGCD(absA, absB)), absB, product);
+            assert(!isOverflow && product <= static_cast<U>(std::numeric_limits<T>::max()) && "LCM: Integer overflow, (absA / g) * absB would exceed max value for type T");
+            return static_cast<T>(product);
+        }
+
+        /* LCM of every value, 1 for none and 0 when any value is 0 */
+        template <typename T, std::size_t Extent>
+            requires std::integral<std::remove_const_t<T>>
+        [[nodiscard]] constexpr std::remove_const_t<T> LCM(std::span<T, Extent> values) noexcept
+        {
+            std::remove_const_t<T> result = 1;
+            for (const auto value : values)
+            {
+                if (value == 0) return 0;
+                result = LCM(result, value);
+            }
+            return result;
         }
     #pragma endregion
 
@@ -203,75 +931,336 @@ namespace winxframe
         }
     #pragma endregion
 
-    #pragma region COMBINATORICS
-        /* Returns n!, the product of the first n natural numbers */
-        [[nodiscard]] constexpr unsigned long long Factorial(int n) noexcept
+    #pragma region MODULAR ARITHMETIC
+        /*
+        * Arithmetic modulo a fixed m > 1 below 2^64, products are taken to 128 bits so no modulus overflows.
+        * Odd moduli use Montgomery reduction: values are held as residues a * 2^64 mod m, and a product of residues is reduced with two
+        * multiplications and a subtraction instead of a division. Even moduli keep values as they are and divide the 128-bit product.
+        * MulMod(), PowMod() and InvMod() take and return ordinary values, loops that multiply many times can stay in residue form through
+        * ToResidue(), MulResidue(), PowResidue() and FromResidue().
+        */
+        class ModContext
         {
-            // 21! = 51,090,942,171,709,440,000 > ULLONG_MAX (approx. 1.84e19)
-            assert(n >= 0 && n <= 20 && "Factorial: n >= 0! && n <= 20!");
-            constexpr unsigned long long factorialTable[] = {
-                1ULL,                               // 0!
-                1ULL,                               // 1!
-                2ULL,                               // 2!
-                6ULL,                               // 3!
-                24ULL,                              // 4!
-                120ULL,                             // 5!
-                720ULL,                             // 6!
-                5040ULL,                            // 7!
-                40320ULL,                           // 8!
-                362'880ULL,                         // 9!
-                3'628'800ULL,                       // 10!
-                39'916'800ULL,                      // 11!
-                479'001'600ULL,                     // 12!
-                6'227'020'800ULL,                   // 13!
-                87'178'291'200ULL,                  // 14!
-                1'307'674'368'000ULL,               // 15!
-                20'922'789'888'000ULL,              // 16!
-                355'687'428'096'000ULL,             // 17!
-                6'402'373'705'728'000ULL,           // 18!
-                121'645'100'408'832'000ULL,         // 19!
-                2'432'902'008'176'640'000ULL        // 20!
-            };
+        private:
+            std::uint64_t modulus_;
+            std::uint64_t inverse_ = 0;         // m^-1 mod 2^64 (odd moduli)
+            std::uint64_t one_ = 1;             // residue of 1, 2^64 mod m for odd moduli
+            std::uint64_t oneSquared_ = 1;      // 2^128 mod m for odd moduli, converts values into residues
 
-            return factorialTable[n];
+            /* a * b * 2^-64 mod m for a * b < m * 2^64: the low half of a * b is cancelled by u * m with u = low * m^-1 mod 2^64 */
+            [[nodiscard]] constexpr std::uint64_t Redc(std::uint64_t a, std::uint64_t b) const noexcept
+            {
+                std::uint64_t high = 0, correctionHigh = 0;
+                const std::uint64_t low = detail::MulWide(a, b, high);
+                static_cast<void>(detail::MulWide(low * inverse_, modulus_, correctionHigh));
+                return high >= correctionHigh ? high - correctionHigh : high - correctionHigh + modulus_;
+            }
+
+            [[nodiscard]] constexpr bool IsMontgomery() const noexcept { return (modulus_ & 1) != 0; }
+
+        public:
+            constexpr explicit ModContext(std::uint64_t modulus) noexcept : modulus_(modulus)
+            {
+                assert(modulus > 1 && "ModContext: modulus must be greater than 1");
+                if (IsMontgomery())
+                {
+                    // Newton's iteration doubles the correct low bits of m^-1, starting from 3 (m * m == 1 mod 8 for odd m)
+                    inverse_ = modulus_;
+                    for (int i = 0; i < 5; ++i)
+                        inverse_ *= 2 - modulus_ * inverse_;
+                    one_ = (0 - modulus_) % modulus_;
+                    std::uint64_t high = 0;
+                    const std::uint64_t low = detail::MulWide(one_, one_, high);
+                    oneSquared_ = detail::Mod128(high, low, modulus_);
+                }
+            }
+
+            [[nodiscard]] constexpr std::uint64_t Modulus() const noexcept { return modulus_; }
+
+            /* Residue form of a < m */
+            [[nodiscard]] constexpr std::uint64_t ToResidue(std::uint64_t a) const noexcept
+            {
+                return IsMontgomery() ? Redc(a, oneSquared_) : a;
+            }
+
+            /* Ordinary value of residue x */
+            [[nodiscard]] constexpr std::uint64_t FromResidue(std::uint64_t x) const noexcept
+            {
+                return IsMontgomery() ? Redc(x, 1) : x;
+            }
+
+            /* Product of residues x < m and y, for ordinary values the product times 2^-64 (mod m) */
+            [[nodiscard]] constexpr std::uint64_t MulResidue(std::uint64_t x, std::uint64_t y) const noexcept
+            {
+                if (IsMontgomery())
+                    return Redc(x, y);
+                std::uint64_t high = 0;
+                const std::uint64_t low = detail::MulWide(x, y, high);
+                return detail::Mod128(high, low, modulus_);
+            }
+
+            /* (a + b) mod m for a, b < m, the same for residues */
+            [[nodiscard]] constexpr std::uint64_t AddMod(std::uint64_t a, std::uint64_t b) const noexcept
+            {
+                return a >= modulus_ - b ? a - (modulus_ - b) : a + b;
+            }
+
+            /* (a - b) mod m for a, b < m, the same for residues */
+            [[nodiscard]] constexpr std::uint64_t SubMod(std::uint64_t a, std::uint64_t b) const noexcept
+            {
+                return a >= b ? a - b : a + (modulus_ - b);
+            }
+
+            /* (a * b) mod m for a < m and any b */
+            [[nodiscard]] constexpr std::uint64_t MulMod(std::uint64_t a, std::uint64_t b) const noexcept
+            {
+                assert(a < modulus_ && "MulMod: a must be less than the modulus");
+                return IsMontgomery() ? Redc(Redc(a, b), oneSquared_) : MulResidue(a, b);
+            }
+
+            /* Residue of x^exponent for residue x < m, by squaring without leaving residue form */
+            [[nodiscard]] constexpr std::uint64_t PowResidue(std::uint64_t x, std::uint64_t exponent) const noexcept
+            {
+                std::uint64_t result = one_;
+                while (exponent > 0)
+                {
+                    if (exponent & 1)
+                        result = MulResidue(result, x);
+                    exponent >>= 1;
+                    if (exponent)
+                        x = MulResidue(x, x);
+                }
+                return result;
+            }
+
+            /* base^exponent mod m by squaring in residue form */
+            [[nodiscard]] constexpr std::uint64_t PowMod(std::uint64_t base, std::uint64_t exponent) const noexcept
+            {
+                return FromResidue(PowResidue(ToResidue(base % modulus_), exponent));
+            }
+
+            /* a^-1 mod m for GCD(a, m) == 1 */
+            [[nodiscard]] constexpr std::uint64_t InvMod(std::uint64_t a) const noexcept
+            {
+                return detail::InverseMod(a, modulus_);
+            }
+        };
+    #pragma endregion
+
+    #pragma region PRIMALITY
+        /*
+        * Deterministic Miller-Rabin test for every 64-bit n. The seven bases of Jim Sinclair have no strong pseudoprime in common below 2^64,
+        * the squarings stay in ModContext residue form. Multiples of the primes up to 37 are settled by trial division first.
+        */
+        [[nodiscard]] constexpr bool IsPrime(std::uint64_t n) noexcept
+        {
+            constexpr std::uint64_t smallPrimes[] = { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+            if (n < 2) return false;
+            for (const std::uint64_t p : smallPrimes)
+            {
+                if (n % p == 0) return n == p;
+            }
+            if (n < 41 * 41) return true;
+
+            // n - 1 = d * 2^s with d odd
+            const int s = std::countr_zero(n - 1);
+            const std::uint64_t d = (n - 1) >> s;
+            const ModContext context(n);
+            const std::uint64_t one = context.ToResidue(1), minusOne = context.ToResidue(n - 1);
+            constexpr std::uint64_t bases[] = { 2, 325, 9'375, 28'178, 450'775, 9'780'504, 1'795'265'022 };
+            for (const std::uint64_t base : bases)
+            {
+                const std::uint64_t a = base % n;
+                if (a == 0) continue;
+                std::uint64_t x = context.PowResidue(context.ToResidue(a), d);
+                if (x == one || x == minusOne) continue;
+                bool isWitness = true;
+                for (int i = 1; i < s && isWitness; ++i)
+                {
+                    x = context.MulResidue(x, x);
+                    isWitness = x != minusOne;
+                }
+                if (isWitness) return false;
+            }
+            return true;
         }
+    #pragma endregion
 
-        /* Computes the modular inverse of a modulo m using the extended Euclidean algorithm, i.e., finds x such that (a * x) % m == 1 */
-        template<std::integral T>
-            requires std::is_unsigned_v<T> || std::is_signed_v<T>
-        [[nodiscard]] constexpr T ModInverse(T a, T m) noexcept
+    #pragma region FACTORIZATION
+        namespace detail
         {
-            assert(m > 0 && "ModInverse: modulus must be positive");
-            assert(GCD(a, m) == 1 && "ModInverse: inverse does not exist when GCD(a, m) != 1");
-            if (m == 1) return 0;
+            /* Primes below 256, the trial divisors of Factorize() */
+            inline constexpr std::uint32_t smallPrimes[] = {
+                2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61, 67, 71, 73, 79, 83, 89, 97, 101, 103, 107, 109, 113, 127,
+                131, 137, 139, 149, 151, 157, 163, 167, 173, 179, 181, 191, 193, 197, 199, 211, 223, 227, 229, 233, 239, 241, 251 };
 
-            long long mod = static_cast<long long>(m);
-            long long x0 = 0, x1 = 1;
-            long long t, q;
-            long long aSigned = static_cast<long long>(a);
+            /*
+            * Brent's variant of Pollard rho on x -> x^2 + c for an odd composite n, returns a factor 1 < d < n or 0 when this c fails.
+            * The iterates stay in ModContext residue form, which only scales them by 2^64 (mod n) and keeps every gcd with n unchanged.
+            * The differences |x - y| are multiplied into a running product and one GCD is taken per batchSize steps, a batch that meets a
+            * factor of n as a whole is replayed one step at a time from its start.
+            */
+            [[nodiscard]] inline std::uint64_t PollardBrent(std::uint64_t n, std::uint64_t c) noexcept
+            {
+                constexpr std::uint64_t batchSize = 128;
+                const ModContext context(n);
+                const std::uint64_t increment = context.ToResidue(c % n);
+                const auto step = [&context, increment](std::uint64_t x) { return context.AddMod(context.MulResidue(x, x), increment); };
 
-            while (aSigned > 1)
+                std::uint64_t y = context.ToResidue(2 % n), x = y, saved = y, product = context.ToResidue(1);
+                std::uint64_t divisor = 1;
+                for (std::uint64_t length = 1; divisor == 1; length *= 2)
+                {
+                    x = y;
+                    for (std::uint64_t i = 0; i < length; ++i)
+                        y = step(y);
+                    for (std::uint64_t done = 0; done < length && divisor == 1; done += batchSize)
+                    {
+                        saved = y;
+                        const std::uint64_t count = Min(batchSize, length - done);
+                        for (std::uint64_t i = 0; i < count; ++i)
+                        {
+                            y = step(y);
+                            product = context.MulResidue(product, x > y ? x - y : y - x);
+                        }
+                        divisor = BinaryGCD(product, n);
+                    }
+                }
+
+                if (divisor == n)
+                {
+                    // the batch multiplied in a zero or every factor at once: retrace it
+                    do
+                    {
+                        saved = step(saved);
+                        divisor = BinaryGCD(x > saved ? x - saved : saved - x, n);
+                    } while (divisor == 1);
+                }
+                return divisor == n ? 0 : divisor;
+            }
+        }; // end of namespace detail
+
+        /*
+        * Returns the prime factorization of n as (prime, multiplicity) pairs in increasing order of the primes, empty for 1 and for 0 (which
+        * has none).
+        * Trial division removes the primes below 256, IsPrime() settles each remaining cofactor, and composite ones are split by Brent's
+        * Pollard rho, whose expected cost grows with the square root of the smallest prime factor: around 2^16 steps for a semiprime of
+        * two 31-bit primes, where trial division would take 2^30 divisions.
+        */
+        [[nodiscard]] inline std::vector<std::pair<std::uint64_t, int>> Factorize(std::uint64_t n)
+        {
+            std::vector<std::pair<std::uint64_t, int>> factors;
+            // 0 is divisible by every trial divisor, dividing it out would never end
+            if (n == 0) return factors;
+
+            for (const std::uint32_t p : detail::smallPrimes)
             {
-                q = aSigned / mod;
-                t = mod;
+                if (n % p != 0) continue;
+                int multiplicity = 0;
+                do
+                {
+                    n /= p;
+                    ++multiplicity;
+                } while (n % p == 0);
+                factors.emplace_back(p, multiplicity);
+            }
+            if (n == 1) return factors;
+
+            // cofactors without a prime below 257 are prime below 257^2, composite ones are split until every part is prime
+            std::vector<std::uint64_t> primes, pending{ n };
+            while (!pending.empty())
+            {
+                const std::uint64_t m = pending.back();
+                pending.pop_back();
+                if (m < 257 * 257 || IsPrime(m))
+                {
+                    primes.push_back(m);
+                    continue;
+                }
+                std::uint64_t divisor = 0;
+                for (std::uint64_t c = 1; divisor == 0; ++c)
+                    divisor = detail::PollardBrent(m, c);
+                pending.push_back(divisor);
+                pending.push_back(m / divisor);
+            }
+
+            std::sort(primes.begin(), primes.end());
+            for (const std::uint64_t prime : primes)
+            {
+                if (factors.empty() || factors.back().first != prime)
+                    factors.emplace_back(prime, 1);
+                else
+                    ++factors.back().second;
+            }
+            return factors;
+        }
+    #pragma endregion
 
-                mod = aSigned % mod;
-                aSigned = t;
-                t = x0;
+    #pragma region COMBINATORICS
+        /*
+        * Returns n!, the product of the first n natural numbers.
+        * Integral types read a table and assert that n! fits (20! for unsigned long long), other types such as BigInt multiply a balanced
+        * product tree, so that the operands of each multiplication have similar sizes.
+        */
+        template <typename T = unsigned long long>
+        [[nodiscard]] constexpr T Factorial(int n) noexcept(std::is_arithmetic_v<T>)
+        {
+            if constexpr (std::integral<T>)
+            {
+                // 21! = 51,090,942,171,709,440,000 > ULLONG_MAX (approx. 1.84e19)
+                assert(n >= 0 && n <= detail::FactorialLimit<T>() && "Factorial: n >= 0! && n! must fit in T");
+                constexpr unsigned long long factorialTable[] = {
+                    1ULL,                               // 0!
+                    1ULL,                               // 1!
+                    2ULL,                               // 2!
+                    6ULL,                               // 3!
+                    24ULL,                              // 4!
+                    120ULL,                             // 5!
+                    720ULL,                             // 6!
+                    5040ULL,                            // 7!
+                    40320ULL,                           // 8!
+                    362'880ULL,                         // 9!
+                    3'628'800ULL,                       // 10!
+                    39'916'800ULL,                      // 11!
+                    479'001'600ULL,                     // 12!
+                    6'227'020'800ULL,                   // 13!
+                    87'178'291'200ULL,                  // 14!
+                    1'307'674'368'000ULL,               // 15!
+                    20'922'789'888'000ULL,              // 16!
+                    355'687'428'096'000ULL,             // 17!
+                    6'402'373'705'728'000ULL,           // 18!
+                    121'645'100'408'832'000ULL,         // 19!
+                    2'432'902'008'176'640'000ULL        // 20!
+                };
 
-                x0 = x1 - q * x0;
-                x1 = t;
+                return static_cast<T>(factorialTable[n]);
             }
-            if (x1 < 0) x1 += m;
+            else
+            {
+                assert(n >= 0 && "Factorial: n >= 0!");
+                return n < 2 ? T(1) : detail::RangeProduct<T>(2, static_cast<unsigned long long>(n) + 1);
+            }
+        }
 
-            return static_cast<T>(x1);
+        /* Computes the modular inverse of a modulo m using the extended Euclidean algorithm, i.e., finds x such that (a * x) % m == 1 */
+        template<std::integral T>
+            requires std::is_unsigned_v<T> || std::is_signed_v<T>
+        [[nodiscard]] constexpr T ModInverse(T a, T m) noexcept
+        {
+            assert(m > 0 && "ModInverse: modulus must be positive");
+            assert(GCD(a, m) == 1 && "ModInverse: inverse does not exist when GCD(a, m) != 1");
+            // negative a is reduced into [0, m) first, the algorithm itself runs on unsigned magnitudes and never overflows
+            return static_cast<T>(detail::InverseMod(static_cast<std::uint64_t>(Mod(a, m)), static_cast<std::uint64_t>(m)));
         }
 
-        /* Computes the binomial coefficient C(n, k) modulo p safely for n, k < p using factorials and the modular inverse of k! */
-        [[nodiscard]] constexpr unsigned long long ModBinomialSmall(unsigned long long n, unsigned long long k, unsigned long long p) noexcept
+        /*
+        * Computes the binomial coefficient C(n, k) modulo p safely for n, k < p using factorials and the modular inverse of k!
+        * Both running products go through context.MulResidue(), which leaves the same factor 2^-64 per step in each, so they cancel in the
+        * quotient and no product needs a division.
+        */
+        [[nodiscard]] constexpr unsigned long long ModBinomialSmall(unsigned long long n, unsigned long long k, const ModContext& context) noexcept
         {
-            assert(p > 1 && "ModBinomialSmall: modulus must be greater than 1");
-            assert(n < p && k < p && "ModBinomialSmall: n and k must be less than p");
+            assert(n < context.Modulus() && k < context.Modulus() && "ModBinomialSmall: n and k must be less than p");
             if (k > n) return 0;
             if (k == 0 || k == n) return 1;
 
@@ -281,11 +1270,17 @@ namespace winxframe
 
             for (unsigned long long i = 0; i < k; ++i)
             {
-                numerator = (numerator * (n - i)) % p;
-                denominator = (denominator * (i + 1)) % p;
+                numerator = context.MulResidue(numerator, n - i);
+                denominator = context.MulResidue(denominator, i + 1);
             }
 
-            return (numerator * ModInverse(denominator, p)) % p;
+            return context.MulMod(numerator, context.InvMod(denominator));
+        }
+
+        [[nodiscard]] constexpr unsigned long long ModBinomialSmall(unsigned long long n, unsigned long long k, unsigned long long p) noexcept
+        {
+            assert(p > 1 && "ModBinomialSmall: modulus must be greater than 1");
+            return ModBinomialSmall(n, k, ModContext(p));
         }
 
         /* Computes C(n, k) % p for arbitrary n, k using Lucas' theorem recursively, reducing the problem to calls of ModBinomialSmall */
@@ -295,6 +1290,7 @@ namespace winxframe
             if (k > n) return 0;
             if (k == 0 || k == n) return 1;
 
+            const ModContext context(p);
             unsigned long long result = 1;
 
             while (n > 0 || k > 0)
@@ -303,7 +1299,7 @@ namespace winxframe
                 const unsigned long long kModP = k % p;
                 if (kModP > nModP) return 0;
 
-                result = (result * ModBinomialSmall(nModP, kModP, p)) % p;
+                result = context.MulMod(result, ModBinomialSmall(nModP, kModP, context));
                 n /= p;
                 k /= p;
             }
@@ -311,13 +1307,16 @@ namespace winxframe
             return result;
         }
 
-        #pragma region EXPONENTIATION BY SQUARING
+        #pragma region EXPONENTIATION
             /* Computes the value of a base raised to a given power (integral) */
-            template<typename T>
-                requires std::integral<T>
-            [[nodiscard]] constexpr T Pow(T base, int exponent) noexcept
+            template<typename T, typename E>
+                requires std::integral<T> && std::integral<E>
+            [[nodiscard]] constexpr T Pow(T base, E exponent) noexcept
             {
-                if (exponent < 0) return 0;
+                if constexpr (std::is_signed_v<E>)
+                {
+                    if (exponent < 0) return 0;
+                }
                 if (exponent == 0) return 1;
 
                 T result = 1;
@@ -339,40 +1338,113 @@ namespace winxframe
                 }
                 return result;
             }
-            /* Computes the value of a base raised to a given power (floating point) */
+            /*
+            * Computes the value of a base raised to a real power, e^(exponent * ln(base))
+            * ln(base) is carried to about twice the precision of T and multiplied exactly, so the error of the product does not grow with
+            * |exponent * ln(base)|. Error: within 1 ULP for float, double, and the 64-bit long double (see math_accuracy.cpp).
+            * Special values follow std::pow: finite negative bases need an integral exponent (NaN otherwise), Pow(x, 0) and Pow(1, y) are 1.
+            */
             template<typename T>
                 requires std::floating_point<T>
-            [[nodiscard]] constexpr T Pow(T base, int exponent) noexcept
+            [[nodiscard]] MATH_UTILS_NO_CONTRACT constexpr T Pow(T base, T exponent) noexcept
             {
-                if (exponent == 0)
+                using kernel = detail::ExpLogKernel<T>;
+                constexpr T infinity = std::numeric_limits<T>::infinity();
+                if (exponent == static_cast<T>(0) || base == static_cast<T>(1))
                     return static_cast<T>(1);
-                if (base == static_cast<T>(0))
-                    return exponent > 0 ? static_cast<T>(0) : std::numeric_limits<T>::infinity();
+                if (base != base || exponent != exponent)
+                    return base + exponent;
+
+                const T magnitude = Abs(base);
+                if (exponent == infinity || exponent == -infinity)
+                {
+                    if (magnitude == static_cast<T>(1))
+                        return static_cast<T>(1);
+                    return (magnitude > static_cast<T>(1)) == (exponent > static_cast<T>(0)) ? infinity : static_cast<T>(0);
+                }
+
+                // the sign of the result is negative only for a negative base (including -0 and -infinity) and an odd exponent
+                const int parity = detail::IntegerParity(exponent);
+                const T sign = detail::SignBit(base) && parity == 1 ? static_cast<T>(-1) : static_cast<T>(1);
+                if (magnitude == static_cast<T>(0) || magnitude == infinity)
+                    return sign * ((magnitude == infinity) == (exponent > static_cast<T>(0)) ? infinity : static_cast<T>(0));
+                // only finite negative bases need an integral exponent, Pow(-infinity, 0.5) is infinity
+                if (base < static_cast<T>(0) && parity == 0)
+                    return std::numeric_limits<T>::quiet_NaN();
+                // small integral exponents go through squaring, which is exact whenever T can hold the result
+                if (parity != 0 && Abs(exponent) <= static_cast<T>(64))
+                    return detail::PowIntegral(base, static_cast<int>(exponent));
 
-                bool negExp = exponent < 0;
-                int exp = negExp ? -exponent : exponent;
-                T result = Exp(static_cast<T>(exp) * Log(base));
-                return negExp ? static_cast<T>(1) / result : result;
+                T logHi, logLo;
+                detail::LogExtended(magnitude, logHi, logLo);
+                const T productEstimate = exponent * logHi;
+                if (productEstimate > kernel::maxExp)
+                    return sign * infinity;
+                if (productEstimate < kernel::minExp)
+                    return sign * static_cast<T>(0);
+                if (Abs(productEstimate) < std::numeric_limits<T>::epsilon())
+                    return sign * (static_cast<T>(1) + productEstimate);
+
+                T productHi, productLo;
+                detail::TwoProduct(exponent, logHi, productHi, productLo);
+                productLo += exponent * logLo;
+                return sign * detail::ExpReduced(productHi, productLo);
             }
+
+            /*
+            * Computes the value of a base raised to a given power (floating point)
+            * Squaring like the integral Pow(), so results that T can hold (Pow(2.0, 10), Pow(-3.0, 5)) are exact and negative bases keep
+            * their sign. The rounding error of every multiplication is carried along and the binary exponent is kept apart until the end,
+            * so other results are within 1 ULP for any exponent, up to the overflow threshold and down into the subnormal range (see
+            * math_accuracy.cpp). Exponents outside the range of int go through Pow(T, T) on the magnitude of the base.
+            */
+            template<typename T, typename E>
+                requires std::floating_point<T> && std::integral<E>
+            [[nodiscard]] MATH_UTILS_NO_CONTRACT constexpr T Pow(T base, E exponent) noexcept
+            {
+                if (std::in_range<int>(exponent))
+                    return detail::PowIntegral(base, static_cast<int>(exponent));
+                const bool isNegative = detail::SignBit(base);
+                const T magnitude = Pow(isNegative ? -base : base, static_cast<T>(exponent));
+                return isNegative && (exponent & 1) != 0 ? -magnitude : magnitude;
+            }
+
+            /* Mixed floating point types would pick the integral exponent overload and truncate the exponent, cast one of them instead */
+            template<typename T, typename U>
+                requires std::floating_point<T> && std::floating_point<U> && (!std::same_as<T, U>)
+            T Pow(T base, U exponent) = delete;
         #pragma endregion
     #pragma endregion
 
     #pragma region SEQUENCE/RECURRENCE
-        /* Computes the n-th Fibonacci number */
-        [[nodiscard]] constexpr unsigned long long Fibonacci(const int n) noexcept
+        /*
+        * Computes the n-th Fibonacci number in O(log n) multiplications by fast doubling.
+        * T is any type with +, - and *: integral types assert that F(n) fits (F(93) for unsigned long long, F(94) = 19,740,274,219,868,223,167 > ULLONG_MAX),
+        * BigInt gives exact values of any size.
+        */
+        template <typename T = unsigned long long>
+        [[nodiscard]] constexpr T Fibonacci(const int n) noexcept(std::is_arithmetic_v<T>)
         {
-            // Derived from Binet's formula: F(n) = (phi^(n)-(-phi)^(-n)) / sqrt(5), where phi approx. 1.618
-            // F(94) = 19,740,274,219,868,223,167 > ULLONG_MAX
-            assert(n >= 0 && n <= 93 && "Fibonacci: n >= F(0) && n <= F(93)");
-            //if (n < 0 || n > 93) return 0;
-            if (n < 2) return n;
-            unsigned long long a = 0, b = 1;
-            for (int i = 2; i <= n; ++i)
-            {
-                b += a;     // add previous value directly
-                a = b - a;  // recalculate previous value without temp
-            }
-            return b;
+            if constexpr (std::integral<T>)
+                assert(n >= 0 && n <= detail::FibonacciLimit<T>() && "Fibonacci: n >= F(0) && F(n) must fit in T");
+            else
+                assert(n >= 0 && "Fibonacci: n >= F(0)");
+            return detail::FibonacciDoubling<T>(static_cast<unsigned long long>(n), T(0), T(1),
+                [](const T& a, const T& b) { return T(a + b); },
+                [](const T& a, const T& b) { return T(a - b); },
+                [](const T& a, const T& b) { return T(a * b); });
+        }
+
+        /* Computes F(n) mod m for any n, fast doubling on ModContext residues */
+        [[nodiscard]] constexpr unsigned long long Fibonacci(const unsigned long long n, const unsigned long long m) noexcept
+        {
+            assert(m > 0 && "Fibonacci: modulus must be positive");
+            if (m == 1) return 0;
+            const ModContext context(m);
+            return context.FromResidue(detail::FibonacciDoubling<std::uint64_t>(n, 0, context.ToResidue(1),
+                [&context](std::uint64_t a, std::uint64_t b) { return context.AddMod(a, b); },
+                [&context](std::uint64_t a, std::uint64_t b) { return context.SubMod(a, b); },
+                [&context](std::uint64_t a, std::uint64_t b) { return context.MulResidue(a, b); }));
         }
 
         /* Computes the sum of the first n natural numbers (int) */
@@ -0,0 +1,258 @@
+/*!
+lib\include\utils\prime_sieve.hpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Prime Sieve header file.
+
+\note
+Segmented sieve of Eratosthenes over the odd numbers of [lo, hi), one bit per odd number. Each segment holds sieveSegmentBytes of
+bits so that it stays in the L2 cache while the base primes up to sqrt(hi) cross it out. Worker threads sieve segments into a ring
+of buffers, two per thread, and the calling thread hands the finished segments to the consumer in increasing order, so the memory
+in use is bounded by the ring and the base primes whatever the size of the range (78,498 base primes for hi = 10^12).
+*/
+
+#pragma once
+
+#ifndef PRIME_SIEVE_HPP_
+#define PRIME_SIEVE_HPP_
+
+#include "math_utils.hpp"
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <mutex>
+#include <span>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace winxframe
+{
+    namespace math_utils
+    {
+        /* Bytes of sieve per segment, 2^20 odd numbers: 64 KB to 256 KB segments ran within 20% of each other on x64, 32 KB and 512 KB slower */
+        inline constexpr std::size_t sieveSegmentBytes = std::size_t{ 1 } << 17;
+
+        /* Largest exclusive upper bound of a sieve, the base primes below 2^24 stay below 1.1 million */
+        inline constexpr std::uint64_t sieveLimit = std::uint64_t{ 1 } << 48;
+
+        namespace detail
+        {
+            /* Odd primes p with p * p < limit by a plain sieve of Eratosthenes, the base primes of the segments */
+            inline std::vector<std::uint32_t> BasePrimes(std::uint64_t limit)
+            {
+                std::uint32_t root = static_cast<std::uint32_t>(std::sqrt(static_cast<double>(limit)));
+                while (static_cast<std::uint64_t>(root) * root >= limit && root > 0) --root;
+                while (static_cast<std::uint64_t>(root + 1) * (root + 1) < limit) ++root;
+
+                // composite[i] for the odd number 2i + 1
+                std::vector<bool> composite(root / 2 + 1, false);
+                std::vector<std::uint32_t> primes;
+                for (std::uint32_t i = 1; 2 * i + 1 <= root; ++i)
+                {
+                    if (composite[i]) continue;
+                    const std::uint32_t p = 2 * i + 1;
+                    primes.push_back(p);
+                    for (std::uint64_t j = static_cast<std::uint64_t>(p) * p / 2; j < composite.size(); j += p)
+                        composite[j] = true;
+                }
+                return primes;
+            }
+
+            /* Clears the bits of the odd composites in [first, first + 2 * bitCount), bit i standing for first + 2i */
+            inline void SieveSegment(std::uint64_t first, std::size_t bitCount, std::span<const std::uint32_t> basePrimes, std::vector<std::uint64_t>& words)
+            {
+                words.assign((bitCount + 63) / 64, ~0ULL);
+                if (bitCount % 64 != 0)
+                    words.back() = (1ULL << (bitCount % 64)) - 1;
+
+                const std::uint64_t end = first + 2 * static_cast<std::uint64_t>(bitCount);
+                for (const std::uint32_t prime : basePrimes)
+                {
+                    const std::uint64_t p = prime;
+                    if (p * p >= end) break;
+                    // first odd multiple of p from max(p^2, first) on, p^2 being the smallest one not crossed out by a smaller prime
+                    std::uint64_t multiple = Max(p * p, (first + p - 1) / p * p);
+                    if ((multiple & 1) == 0)
+                        multiple += p;
+                    for (std::uint64_t bit = (multiple - first) / 2; bit < bitCount; bit += p)
+                        words[bit / 64] &= ~(1ULL << (bit % 64));
+                }
+            }
+
+            /*
+            * Sieves the odd numbers of [max(lo, 3), hi) on threadCount threads (0 for every hardware thread) and calls consume(first, words)
+            * for every segment in increasing order, bit i of words standing for the odd number first + 2i. consume returns false to stop.
+            */
+            template <typename Consume>
+            void SieveSegments(std::uint64_t lo, std::uint64_t hi, std::size_t threadCount, Consume&& consume)
+            {
+                assert(hi <= sieveLimit && "SieveSegments: hi must not exceed sieveLimit");
+                const std::uint64_t oddLo = Max(lo, std::uint64_t{ 3 }) | 1;
+                if (hi <= oddLo) return;
+                const std::uint64_t oddCount = (hi - oddLo + 1) / 2;
+                constexpr std::size_t segmentBits = sieveSegmentBytes * 8;
+                const std::uint64_t segmentCount = (oddCount + segmentBits - 1) / segmentBits;
+                const std::vector<std::uint32_t> basePrimes = BasePrimes(hi);
+
+                const auto segmentFirst = [oddLo](std::uint64_t index) { return oddLo + 2 * index * segmentBits; };
+                const auto segmentBitCount = [oddCount](std::uint64_t index) { return static_cast<std::size_t>(Min<std::uint64_t>(segmentBits, oddCount - index * segmentBits)); };
+
+                if (threadCount == 0)
+                    threadCount = Max<std::size_t>(std::thread::hardware_concurrency(), std::size_t{ 1 });
+                threadCount = static_cast<std::size_t>(Min<std::uint64_t>(threadCount, segmentCount));
+                if (threadCount <= 1)
+                {
+                    std::vector<std::uint64_t> words;
+                    for (std::uint64_t index = 0; index < segmentCount; ++index)
+                    {
+                        SieveSegment(segmentFirst(index), segmentBitCount(index), basePrimes, words);
+                        if (!consume(segmentFirst(index), std::span<const std::uint64_t>(words)))
+                            return;
+                    }
+                    return;
+                }
+
+                // ring of segment buffers: a worker claims the next segment once its slot has been consumed
+                enum class SlotState { Free, Sieving, Ready };
+                struct Slot
+                {
+                    std::vector<std::uint64_t> words;
+                    SlotState state = SlotState::Free;
+                };
+                std::vector<Slot> slots(2 * threadCount);
+                std::mutex mutex;
+                std::condition_variable changed;
+                std::uint64_t nextSegment = 0;
+                bool isStopped = false;
+
+                const auto work = [&]()
+                    {
+                        for (;;)
+                        {
+                            std::uint64_t index = 0;
+                            {
+                                std::unique_lock<std::mutex> lock(mutex);
+                                changed.wait(lock, [&]() { return isStopped || nextSegment >= segmentCount || slots[nextSegment % slots.size()].state == SlotState::Free; });
+                                if (isStopped || nextSegment >= segmentCount) return;
+                                index = nextSegment++;
+                                slots[index % slots.size()].state = SlotState::Sieving;
+                            }
+                            Slot& slot = slots[index % slots.size()];
+                            SieveSegment(segmentFirst(index), segmentBitCount(index), basePrimes, slot.words);
+                            {
+                                std::lock_guard<std::mutex> lock(mutex);
+                                slot.state = SlotState::Ready;
+                            }
+                            changed.notify_all();
+                        }
+                    };
+
+                std::vector<std::thread> workers;
+                workers.reserve(threadCount);
+                for (std::size_t i = 0; i < threadCount; ++i)
+                    workers.emplace_back(work);
+
+                const auto stop = [&]()
+                    {
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            isStopped = true;
+                        }
+                        changed.notify_all();
+                        for (std::thread& worker : workers)
+                            worker.join();
+                    };
+
+                try
+                {
+                    for (std::uint64_t index = 0; index < segmentCount; ++index)
+                    {
+                        Slot& slot = slots[index % slots.size()];
+                        {
+                            std::unique_lock<std::mutex> lock(mutex);
+                            changed.wait(lock, [&]() { return slot.state == SlotState::Ready; });
+                        }
+                        const bool isContinued = consume(segmentFirst(index), std::span<const std::uint64_t>(slot.words));
+                        {
+                            std::lock_guard<std::mutex> lock(mutex);
+                            slot.state = SlotState::Free;
+                        }
+                        changed.notify_all();
+                        if (!isContinued) break;
+                    }
+                }
+                catch (...)
+                {
+                    stop();
+                    throw;
+                }
+                stop();
+            }
+        }; // end of namespace detail
+
+        /**
+        * @brief	Calls callback(p) for every prime lo <= p < hi in increasing order. A callback returning bool stops the sieve by returning false.
+        * @param	std::size_t threadCount : Sieving threads, 0 for std::thread::hardware_concurrency(). The callback always runs on the calling thread.
+        */
+        template <typename Callback>
+        void ForEachPrime(std::uint64_t lo, std::uint64_t hi, Callback&& callback, std::size_t threadCount = 0)
+        {
+            // true to go on, for callbacks with and without a result
+            const auto call = [&callback](std::uint64_t p)
+                {
+                    if constexpr (std::is_same_v<std::invoke_result_t<Callback&, std::uint64_t>, bool>)
+                        return static_cast<bool>(callback(p));
+                    else
+                    {
+                        callback(p);
+                        return true;
+                    }
+                };
+
+            if (lo <= 2 && 2 < hi && !call(2))
+                return;
+            detail::SieveSegments(lo, hi, threadCount, [&call](std::uint64_t first, std::span<const std::uint64_t> words)
+                {
+                    for (std::size_t i = 0; i < words.size(); ++i)
+                    {
+                        for (std::uint64_t bits = words[i]; bits != 0; bits &= bits - 1)
+                        {
+                            if (!call(first + 2 * (64 * static_cast<std::uint64_t>(i) + std::countr_zero(bits))))
+                                return false;
+                        }
+                    }
+                    return true;
+                });
+        }
+
+        /* Returns the number of primes lo <= p < hi, the segments counted by popcount */
+        inline std::uint64_t CountPrimes(std::uint64_t lo, std::uint64_t hi, std::size_t threadCount = 0)
+        {
+            std::uint64_t count = lo <= 2 && 2 < hi ? 1 : 0;
+            detail::SieveSegments(lo, hi, threadCount, [&count](std::uint64_t, std::span<const std::uint64_t> words)
+                {
+                    for (const std::uint64_t word : words)
+                        count += static_cast<std::uint64_t>(std::popcount(word));
+                    return true;
+                });
+            return count;
+        }
+
+        /* Returns the primes lo <= p < hi in increasing order */
+        inline std::vector<std::uint64_t> Primes(std::uint64_t lo, std::uint64_t hi, std::size_t threadCount = 0)
+        {
+            std::vector<std::uint64_t> primes;
+            ForEachPrime(lo, hi, [&primes](std::uint64_t p) { primes.push_back(p); }, threadCount);
+            return primes;
+        }
+    }; // end of namespace math_utils
+}; // end of namespace winxframe
+
+#endif
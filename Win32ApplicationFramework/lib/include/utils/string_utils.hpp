@@ -1,7 +1,7 @@
 /*!
 lib\include\utils\string_utils.hpp
 Created: October 12, 2025
-Updated: October 30, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 String Utilities header file.
@@ -32,6 +32,42 @@ namespace winxframe
         }
     #pragma endregion
 
+    #pragma region String Matching
+        /* Matches text against a wildcard pattern, where '*' matches any sequence (including empty) and '?' matches any single character */
+        [[nodiscard]] constexpr bool GlobMatch(std::string_view pattern, std::string_view text) noexcept
+        {
+            std::size_t p = 0, t = 0;
+            std::size_t starPattern = std::string_view::npos, starText = 0;
+
+            while (t < text.size())
+            {
+                if (p < pattern.size() && (pattern[p] == '?' || pattern[p] == text[t]))
+                {
+                    ++p;
+                    ++t;
+                }
+                else if (p < pattern.size() && pattern[p] == '*')
+                {
+                    // remember the star and first try matching it against an empty sequence
+                    starPattern = p++;
+                    starText = t;
+                }
+                else if (starPattern != std::string_view::npos)
+                {
+                    // backtrack, letting the last star swallow one more character
+                    p = starPattern + 1;
+                    t = ++starText;
+                }
+                else
+                    return false;
+            }
+
+            while (p < pattern.size() && pattern[p] == '*')
+                ++p;
+            return p == pattern.size();
+        }
+    #pragma endregion
+
     #pragma region String Conversions
         [[nodiscard]] constexpr std::wstring ToWide(std::string_view string) noexcept
         {
@@ -1,7 +1,7 @@
 /*!
 lib\include\utils\time_utils.hpp
 Created: October 27, 2025
-Updated: October 30, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Time Utilities header file.
@@ -26,10 +26,10 @@ namespace winxframe
             std::string unit;
         };
 
-        [[nodiscard]] constexpr double_time ConvertToDouble(std::chrono::nanoseconds elapsed) noexcept
+        [[nodiscard]] constexpr double_time ConvertToDouble(std::chrono::duration<double, std::nano> elapsed) noexcept
         {
             const char* units[] = { "ns", "us", "ms", "s", "min" };
-            double time = static_cast<double>(elapsed.count());
+            double time = elapsed.count();
             int unitIndex = 0;
 
             while (time >= 1000.0 && unitIndex < 4)
@@ -46,6 +46,11 @@ namespace winxframe
             }
             return { time, units[unitIndex] };
         }
+
+        [[nodiscard]] constexpr double_time ConvertToDouble(std::chrono::nanoseconds elapsed) noexcept
+        {
+            return ConvertToDouble(std::chrono::duration<double, std::nano>(elapsed));
+        }
     #pragma endregion
     }; // end of namespace time_utils
 }; // end of namespace winxframe
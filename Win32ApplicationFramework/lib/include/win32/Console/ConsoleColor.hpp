@@ -1,10 +1,15 @@
 /*!
 lib\include\win32\Console\ConsoleColor.hpp
 Created: November 1, 2025
-Updated: November 5, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Console Color header file.
+
+\note
+By default inserting a ConsoleColor into a stream sets the console text attribute immediately, which is only correct when the stream is
+flushed straight to the console. A stream tagged with console_color::ansi instead receives the color as an ANSI/VT escape sequence, so it
+can be buffered and written later; a stream tagged with console_color::plain drops colors entirely.
 */
 
 #pragma once
@@ -15,6 +20,7 @@ Console Color header file.
 #include <windows.h>
 #include <ostream>
 #include <cstdint>
+#include <cstdio>
 
 namespace winxframe
 {
@@ -51,8 +57,25 @@ namespace winxframe
                 : foreground_(fg), background_(bg) {}
 
             constexpr WORD ToWord() const { return (WORD)(foreground_ | (background_ << 4)); }
+            constexpr uint8_t GetForeground() const { return foreground_; }
+            constexpr uint8_t GetBackground() const { return background_; }
         };
 
+        // how a stream renders inserted colors, stored in the stream's iword slot
+        enum class StreamMode : long { Console = 0, Ansi = 1, Plain = 2 };
+
+        inline int StreamModeIndex()
+        {
+            static const int index = std::ios_base::xalloc();
+            return index;
+        }
+
+        inline std::ostream& ansi(std::ostream& os) { os.iword(StreamModeIndex()) = static_cast<long>(StreamMode::Ansi); return os; }
+        inline std::ostream& plain(std::ostream& os) { os.iword(StreamModeIndex()) = static_cast<long>(StreamMode::Plain); return os; }
+
+        // the console palette is BGR, ANSI colors are RGB
+        constexpr int ToAnsiIndex(uint8_t color) { return ((color & RED) ? 1 : 0) | ((color & GREEN) ? 2 : 0) | ((color & BLUE) ? 4 : 0); }
+
         // constructed colors
         constexpr ConsoleColor Default(WHITE, BLACK);
         constexpr ConsoleColor BrightWhite(BRIGHT_WHITE, BLACK);
@@ -67,8 +90,30 @@ namespace winxframe
     // output operator
     inline std::ostream& operator<<(std::ostream& os, const console_color::ConsoleColor& color)
     {
-        HANDLE hConsole = GetStdHandle(STD_OUTPUT_HANDLE);
-        SetConsoleTextAttribute(hConsole, color.ToWord());
+        using namespace console_color;
+        switch (static_cast<StreamMode>(os.iword(StreamModeIndex())))
+        {
+        case StreamMode::Ansi:
+        {
+            // the default color resets to the terminal's own colors, and a black background is left as the terminal background
+            char sequence[16] = "\x1b[0m";
+            int length = 4;
+            if (color.ToWord() != Default.ToWord())
+            {
+                const uint8_t fg = color.GetForeground(), bg = color.GetBackground();
+                const int fgCode = ((fg & BRIGHT) ? 90 : 30) + ToAnsiIndex(fg);
+                const int bgCode = bg == BLACK ? 49 : ((bg & BRIGHT) ? 100 : 40) + ToAnsiIndex(bg);
+                length = std::snprintf(sequence, sizeof(sequence), "\x1b[%d;%dm", fgCode, bgCode);
+            }
+            os.rdbuf()->sputn(sequence, length); // bypasses the stream's width so a pending std::setw applies to the next field
+            break;
+        }
+        case StreamMode::Plain:
+            break;
+        default:
+            SetConsoleTextAttribute(GetStdHandle(STD_OUTPUT_HANDLE), color.ToWord());
+            break;
+        }
         return os;
     }
 
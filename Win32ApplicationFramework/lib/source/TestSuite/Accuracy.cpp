@@ -0,0 +1,150 @@
+/*!
+lib\source\TestSuite\Accuracy.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Accuracy source file.
+*/
+
+#include <TestSuite/Accuracy.hpp>
+#include <bit>
+
+namespace winxframe
+{
+	namespace
+	{
+		constexpr std::chrono::nanoseconds MIN_BATCH_TIME = std::chrono::milliseconds(2);
+		constexpr int TIMED_BATCHES = 5;
+
+		/* Maps a double to a signed integer that orders like the double, with adjacent doubles mapping to adjacent integers */
+		std::int64_t OrderedKey(double value) noexcept
+		{
+			const std::int64_t bits = std::bit_cast<std::int64_t>(value);
+			return bits >= 0 ? bits : -(bits & INT64_MAX);
+		}
+
+		double FromOrderedKey(std::int64_t key) noexcept
+		{
+			return key >= 0 ? std::bit_cast<double>(key) : std::bit_cast<double>(static_cast<std::uint64_t>(-key) | (1ULL << 63));
+		}
+	}
+
+	/* CONSTRUCTOR */
+
+	AccuracyCase::AccuracyCase(const std::string& name, double low, double high, double maxUlp, const std::string& group, const std::string& section) :
+		TestCase(name, group, section),
+		low_(std::min(low, high)),
+		high_(std::max(low, high)),
+		maxUlp_(maxUlp)
+	{
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void AccuracyStats::Record(double input, double ulp, long double value, long double reference)
+	{
+		++samples;
+		std::size_t bucket = 0;
+		while (bucket < bucketLimits.size() && ulp > bucketLimits[bucket])
+			++bucket;
+		++buckets[bucket];
+
+		if (std::isinf(ulp))
+			++mismatches;
+		else
+			sumUlp += ulp;
+		maxUlp = std::max(maxUlp, ulp);
+
+		if (ulp == 0.0 || (worst.size() == worstCount && ulp <= worst.back().ulp))
+			return;
+		if (worst.size() == worstCount)
+			worst.pop_back();
+		const auto position = std::find_if(worst.begin(), worst.end(), [ulp](const AccuracyWorst& entry) { return ulp > entry.ulp; });
+		worst.insert(position, AccuracyWorst{ input, ulp, value, reference });
+	}
+
+	void AccuracyStats::Merge(const AccuracyStats& other)
+	{
+		samples += other.samples;
+		for (std::size_t i = 0; i < buckets.size(); ++i)
+			buckets[i] += other.buckets[i];
+		maxUlp = std::max(maxUlp, other.maxUlp);
+		sumUlp += other.sumUlp;
+		mismatches += other.mismatches;
+
+		worst.insert(worst.end(), other.worst.begin(), other.worst.end());
+		std::stable_sort(worst.begin(), worst.end(), [](const AccuracyWorst& lhs, const AccuracyWorst& rhs) { return lhs.ulp > rhs.ulp; });
+		if (worst.size() > worstCount)
+			worst.resize(worstCount);
+	}
+
+	void AccuracyCase::Run()
+	{
+		stats_ = AccuracyStats{};
+
+		// contiguous index ranges per thread, merged in thread order so the worst inputs are reported deterministically
+		const std::size_t threadCount = static_cast<std::size_t>(std::min<std::uint64_t>(std::max(1u, std::thread::hardware_concurrency()), sampleCount_));
+		std::vector<AccuracyStats> threadStats(threadCount);
+		{
+			TraceScope traceScope("sweep", "accuracy");
+			std::vector<std::thread> workers;
+			workers.reserve(threadCount);
+			for (std::size_t i = 0; i < threadCount; ++i)
+			{
+				const std::uint64_t first = sampleCount_ * i / threadCount;
+				const std::uint64_t last = sampleCount_ * (i + 1) / threadCount;
+				workers.emplace_back([this, &threadStats, first, last, i] { this->Sweep(first, last, threadStats[i]); });
+			}
+			for (std::thread& worker : workers)
+				worker.join();
+		}
+		for (const AccuracyStats& stats : threadStats)
+			stats_.Merge(stats);
+
+		{
+			TraceScope traceScope("timing", "accuracy");
+			stats_.nsPerCall = this->TimeCalls(false);
+			stats_.referenceNsPerCall = this->TimeCalls(true);
+		}
+
+		std::ostringstream oss;
+		oss << "max error " << stats_.maxUlp << " ULP exceeds " << maxUlp_ << " ULP";
+		if (!stats_.worst.empty())
+			oss << " at x = " << std::setprecision(17) << stats_.worst.front().input;
+		this->Check(stats_.maxUlp <= maxUlp_, oss.str(), __FILE__, __LINE__);
+	}
+
+	double AccuracyCase::Input(std::uint64_t index, std::uint64_t count) const noexcept
+	{
+		const std::int64_t lowKey = OrderedKey(low_);
+		const std::int64_t highKey = OrderedKey(high_);
+		if (count < 2)
+			return low_;
+
+		// span / (count - 1) * index without overflowing, count is limited to 2^32 by SetSampleCount()
+		const std::uint64_t span = static_cast<std::uint64_t>(highKey) - static_cast<std::uint64_t>(lowKey);
+		const std::uint64_t steps = count - 1;
+		const std::uint64_t offset = span / steps * index + span % steps * index / steps;
+		return FromOrderedKey(static_cast<std::int64_t>(static_cast<std::uint64_t>(lowKey) + offset));
+	}
+
+	double AccuracyCase::NsPerCall(const std::function<void(std::uint64_t)>& batch)
+	{
+		auto timeBatch = [&batch](std::uint64_t repetitions)
+			{
+				const auto start = std::chrono::high_resolution_clock::now();
+				batch(repetitions);
+				return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::high_resolution_clock::now() - start);
+			};
+
+		std::uint64_t repetitions = 1;
+		while (timeBatch(repetitions) < MIN_BATCH_TIME && repetitions < (1ULL << 30))
+			repetitions *= 2;
+
+		std::chrono::nanoseconds fastest = std::chrono::nanoseconds::max();
+		for (int i = 0; i < TIMED_BATCHES; ++i)
+			fastest = std::min(fastest, timeBatch(repetitions));
+		return static_cast<double>(fastest.count()) / static_cast<double>(repetitions * timingInputCount);
+	}
+}; // end of namespace winxframe
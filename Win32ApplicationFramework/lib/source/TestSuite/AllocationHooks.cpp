@@ -0,0 +1,192 @@
+/*!
+lib\source\TestSuite\AllocationHooks.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Allocation Hooks source file.
+
+\note
+Replaces the global operator new/delete so that AllocationScope can count the allocations of the calling thread. This translation unit
+deliberately does not include framework.h: debug.h redefines 'new', which must not happen while the operators themselves are defined.
+*/
+
+#include <TestSuite/TestMetrics.hpp>
+#include <algorithm>
+#include <cstdlib>
+#include <malloc.h>	// _msize(), _aligned_malloc(), _aligned_msize(), _aligned_free()
+#include <new>
+
+namespace winxframe
+{
+	namespace
+	{
+		// trivially constructible, so the thread_local needs no initialization guard on the allocation path
+		struct AllocationCounters
+		{
+			std::uint32_t scopeDepth;
+			std::uint64_t allocations;
+			std::uint64_t deallocations;
+			std::uint64_t bytesAllocated;
+			std::int64_t liveBytes;
+			std::int64_t peakLiveBytes;
+		};
+
+		thread_local AllocationCounters counters{};
+
+		inline void RecordAllocation(std::size_t size) noexcept
+		{
+			if (counters.scopeDepth == 0)
+				return;
+			++counters.allocations;
+			counters.bytesAllocated += size;
+			counters.liveBytes += static_cast<std::int64_t>(size);
+			counters.peakLiveBytes = std::max(counters.peakLiveBytes, counters.liveBytes);
+		}
+
+		inline void RecordDeallocation(std::size_t size) noexcept
+		{
+			if (counters.scopeDepth == 0)
+				return;
+			++counters.deallocations;
+			counters.liveBytes -= static_cast<std::int64_t>(size);
+		}
+
+		void* Allocate(std::size_t size)
+		{
+			if (size == 0)
+				size = 1;
+			for (;;)
+			{
+				if (void* pointer = std::malloc(size))
+				{
+					RecordAllocation(size);
+					return pointer;
+				}
+				std::new_handler handler = std::get_new_handler();
+				if (!handler)
+					throw std::bad_alloc();
+				handler();
+			}
+		}
+
+		void* AllocateAligned(std::size_t size, std::align_val_t alignment)
+		{
+			if (size == 0)
+				size = 1;
+			for (;;)
+			{
+				if (void* pointer = _aligned_malloc(size, static_cast<std::size_t>(alignment)))
+				{
+					RecordAllocation(size);
+					return pointer;
+				}
+				std::new_handler handler = std::get_new_handler();
+				if (!handler)
+					throw std::bad_alloc();
+				handler();
+			}
+		}
+
+		void Deallocate(void* pointer) noexcept
+		{
+			if (!pointer)
+				return;
+			if (counters.scopeDepth != 0)
+				RecordDeallocation(_msize(pointer));
+			std::free(pointer);
+		}
+
+		void DeallocateAligned(void* pointer, std::align_val_t alignment) noexcept
+		{
+			if (!pointer)
+				return;
+			if (counters.scopeDepth != 0)
+				RecordDeallocation(_aligned_msize(pointer, static_cast<std::size_t>(alignment), 0));
+			_aligned_free(pointer);
+		}
+	}
+
+	/* CONSTRUCTOR */
+
+	AllocationScope::AllocationScope() noexcept :
+		startAllocations_(counters.allocations),
+		startDeallocations_(counters.deallocations),
+		startBytesAllocated_(counters.bytesAllocated),
+		startLiveBytes_(counters.liveBytes),
+		outerPeakLiveBytes_(counters.peakLiveBytes)
+	{
+		counters.peakLiveBytes = counters.liveBytes;
+		++counters.scopeDepth;
+	}
+
+	/* DESTRUCTOR */
+
+	AllocationScope::~AllocationScope()
+	{
+		this->Stop();
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	AllocationStats AllocationScope::Stop() noexcept
+	{
+		if (isStopped_)
+			return stats_;
+
+		--counters.scopeDepth;
+		stats_.allocations = counters.allocations - startAllocations_;
+		stats_.deallocations = counters.deallocations - startDeallocations_;
+		stats_.bytesAllocated = counters.bytesAllocated - startBytesAllocated_;
+		stats_.peakLiveBytes = static_cast<std::uint64_t>(std::max<std::int64_t>(0, counters.peakLiveBytes - startLiveBytes_));
+
+		// an enclosing scope must still see the high water mark reached inside this one
+		counters.peakLiveBytes = std::max(outerPeakLiveBytes_, counters.peakLiveBytes);
+		isStopped_ = true;
+		return stats_;
+	}
+}; // end of namespace winxframe
+
+/* REPLACEABLE ALLOCATION FUNCTIONS */
+
+void* operator new(std::size_t size) { return winxframe::Allocate(size); }
+void* operator new[](std::size_t size) { return winxframe::Allocate(size); }
+void* operator new(std::size_t size, std::align_val_t alignment) { return winxframe::AllocateAligned(size, alignment); }
+void* operator new[](std::size_t size, std::align_val_t alignment) { return winxframe::AllocateAligned(size, alignment); }
+
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	try { return winxframe::Allocate(size); }
+	catch (...) { return nullptr; }
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	try { return winxframe::Allocate(size); }
+	catch (...) { return nullptr; }
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	try { return winxframe::AllocateAligned(size, alignment); }
+	catch (...) { return nullptr; }
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept
+{
+	try { return winxframe::AllocateAligned(size, alignment); }
+	catch (...) { return nullptr; }
+}
+
+void operator delete(void* pointer) noexcept { winxframe::Deallocate(pointer); }
+void operator delete[](void* pointer) noexcept { winxframe::Deallocate(pointer); }
+void operator delete(void* pointer, std::size_t) noexcept { winxframe::Deallocate(pointer); }
+void operator delete[](void* pointer, std::size_t) noexcept { winxframe::Deallocate(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { winxframe::Deallocate(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { winxframe::Deallocate(pointer); }
+void operator delete(void* pointer, std::align_val_t alignment) noexcept { winxframe::DeallocateAligned(pointer, alignment); }
+void operator delete[](void* pointer, std::align_val_t alignment) noexcept { winxframe::DeallocateAligned(pointer, alignment); }
+void operator delete(void* pointer, std::size_t, std::align_val_t alignment) noexcept { winxframe::DeallocateAligned(pointer, alignment); }
+void operator delete[](void* pointer, std::size_t, std::align_val_t alignment) noexcept { winxframe::DeallocateAligned(pointer, alignment); }
+void operator delete(void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept { winxframe::DeallocateAligned(pointer, alignment); }
+void operator delete[](void* pointer, std::align_val_t alignment, const std::nothrow_t&) noexcept { winxframe::DeallocateAligned(pointer, alignment); }
@@ -0,0 +1,148 @@
+/*!
+lib\source\TestSuite\Benchmark.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Benchmark source file.
+*/
+
+#include <TestSuite/Benchmark.hpp>
+#include <cmath>
+#include <numeric>
+
+namespace winxframe
+{
+	namespace benchmark
+	{
+		// defined out of line so the optimizer cannot see that the pointer is never read
+		void UseCharPointer(char const volatile* pointer) noexcept { (void)pointer; }
+	}; // end of namespace benchmark
+
+	namespace
+	{
+		constexpr std::uint64_t MAX_BATCH_ITERATIONS = 1ULL << 40;
+
+		/* Linear interpolation between closest ranks of an already sorted sample set */
+		double Percentile(const std::vector<double>& sorted, double fraction) noexcept
+		{
+			if (sorted.empty()) return 0.0;
+			const double rank = fraction * static_cast<double>(sorted.size() - 1);
+			const std::size_t lower = static_cast<std::size_t>(rank);
+			const std::size_t upper = std::min(lower + 1, sorted.size() - 1);
+			return sorted[lower] + (sorted[upper] - sorted[lower]) * (rank - static_cast<double>(lower));
+		}
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void BenchmarkCase::Run()
+	{
+		// warmup passes, doubling the batch so cheap bodies still reach the warmup time quickly
+		{
+			TraceScope traceScope("warmup", "benchmark");
+			std::chrono::nanoseconds warmupElapsed{};
+			std::uint64_t warmupIterations = 1;
+			do
+			{
+				warmupElapsed += this->TimeBatch(warmupIterations);
+				warmupIterations = std::min(warmupIterations * 2, MAX_BATCH_ITERATIONS);
+			} while (warmupElapsed < warmupTime_);
+		}
+
+		const std::chrono::nanoseconds sampleTime = std::max<std::chrono::nanoseconds>(targetTime_ / static_cast<std::int64_t>(sampleCount_), std::chrono::microseconds(1));
+		std::uint64_t iterations{};
+		{
+			TraceScope traceScope("calibrate", "benchmark");
+			iterations = this->Calibrate(sampleTime);
+		}
+
+		std::vector<double> samples;
+		PerfCounterValues counters{};
+		samples.reserve(sampleCount_);
+		{
+			TraceScope traceScope("samples", "benchmark");
+			traceScope.AddArg("iterations", iterations);
+			for (std::uint64_t i = 0; i < sampleCount_; ++i)
+				samples.push_back(static_cast<double>(this->TimeBatch(iterations, &counters).count()) / static_cast<double>(iterations));
+		}
+
+		stats_ = BenchmarkCase::ComputeStats(std::move(samples), iterations);
+		stats_.counters = counters;
+		this->Check(stats_.samples > 0, std::string("benchmark produced no samples"), __FILE__, __LINE__);
+	}
+
+	std::chrono::nanoseconds BenchmarkCase::TimeBatch(std::uint64_t iterations, PerfCounterValues* counters)
+	{
+		std::chrono::time_point<std::chrono::high_resolution_clock> start, stop;
+		PerfCounters perfCounters;
+
+		// counters are read outside the timed region so they do not inflate the sample
+		if (counters)
+			perfCounters.Start();
+		benchmark::ClobberMemory();
+		start = std::chrono::high_resolution_clock::now();
+		this->RunBatch(iterations);
+		stop = std::chrono::high_resolution_clock::now();
+		benchmark::ClobberMemory();
+		if (counters)
+			*counters += perfCounters.Stop();
+
+		// the slice reuses the batch timestamps, so tracing adds no clock reads to the timed region
+		if (TraceWriter* trace = TraceWriter::Active())
+		{
+			std::string args;
+			TraceWriter::AppendArg(args, "iterations", iterations);
+			trace->WriteComplete("batch", "benchmark", start, stop, args);
+		}
+
+		return stop - start;
+	}
+
+	std::uint64_t BenchmarkCase::Calibrate(std::chrono::nanoseconds sampleTime)
+	{
+		std::uint64_t iterations = 1;
+		while (iterations < MAX_BATCH_ITERATIONS)
+		{
+			const std::chrono::nanoseconds elapsed = this->TimeBatch(iterations);
+			if (elapsed >= sampleTime)
+				break;
+
+			// scale toward the target with 10% headroom, growing at most 10x per step since tiny batches are dominated by timer resolution
+			const double scale = static_cast<double>(sampleTime.count()) / static_cast<double>(std::max<std::int64_t>(elapsed.count(), 1));
+			const double growth = std::min(scale * 1.1, 10.0);
+			iterations = std::min(std::max(iterations + 1, static_cast<std::uint64_t>(std::ceil(static_cast<double>(iterations) * growth))), MAX_BATCH_ITERATIONS);
+		}
+		return iterations;
+	}
+
+	BenchmarkStats BenchmarkCase::ComputeStats(std::vector<double> samples, std::uint64_t iterations)
+	{
+		BenchmarkStats stats{};
+		stats.iterations = iterations;
+		stats.samples = samples.size();
+		if (samples.empty())
+			return stats;
+
+		std::sort(samples.begin(), samples.end());
+		stats.min = samples.front();
+		stats.median = Percentile(samples, 0.50);
+		stats.p90 = Percentile(samples, 0.90);
+		stats.p99 = Percentile(samples, 0.99);
+		stats.mean = std::accumulate(samples.begin(), samples.end(), 0.0) / static_cast<double>(samples.size());
+
+		double sumSquares = 0.0;
+		for (double sample : samples)
+			sumSquares += (sample - stats.mean) * (sample - stats.mean);
+		stats.stddev = samples.size() > 1 ? std::sqrt(sumSquares / static_cast<double>(samples.size() - 1)) : 0.0;
+
+		std::vector<double> deviations;
+		deviations.reserve(samples.size());
+		for (double sample : samples)
+			deviations.push_back(std::abs(sample - stats.median));
+		std::sort(deviations.begin(), deviations.end());
+		stats.mad = Percentile(deviations, 0.50);
+
+		return stats;
+	}
+}; // end of namespace winxframe
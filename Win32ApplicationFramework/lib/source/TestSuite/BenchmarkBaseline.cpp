@@ -0,0 +1,167 @@
+/*!
+lib\source\TestSuite\BenchmarkBaseline.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Benchmark Baseline source file.
+*/
+
+#include <TestSuite/BenchmarkBaseline.hpp>
+#include <cmath>
+#include <limits>
+
+namespace winxframe
+{
+	namespace
+	{
+		/* Continued fraction for the regularized incomplete beta function (modified Lentz's method) */
+		double BetaContinuedFraction(double a, double b, double x) noexcept
+		{
+			constexpr int maxIterations = 200;
+			constexpr double epsilon = 1e-14;
+			constexpr double tiny = 1e-300;
+
+			double c = 1.0;
+			double d = 1.0 - (a + b) * x / (a + 1.0);
+			if (std::abs(d) < tiny) d = tiny;
+			d = 1.0 / d;
+			double h = d;
+
+			for (int m = 1; m <= maxIterations; ++m)
+			{
+				const double m2 = 2.0 * m;
+				double aa = m * (b - m) * x / ((a + m2 - 1.0) * (a + m2));
+				d = 1.0 + aa * d;
+				if (std::abs(d) < tiny) d = tiny;
+				c = 1.0 + aa / c;
+				if (std::abs(c) < tiny) c = tiny;
+				d = 1.0 / d;
+				h *= d * c;
+
+				aa = -(a + m) * (a + b + m) * x / ((a + m2) * (a + m2 + 1.0));
+				d = 1.0 + aa * d;
+				if (std::abs(d) < tiny) d = tiny;
+				c = 1.0 + aa / c;
+				if (std::abs(c) < tiny) c = tiny;
+				d = 1.0 / d;
+				const double delta = d * c;
+				h *= delta;
+				if (std::abs(delta - 1.0) < epsilon)
+					break;
+			}
+			return h;
+		}
+
+		/* Regularized incomplete beta function I_x(a, b) */
+		double IncompleteBeta(double a, double b, double x) noexcept
+		{
+			if (x <= 0.0) return 0.0;
+			if (x >= 1.0) return 1.0;
+
+			const double logFront = std::lgamma(a + b) - std::lgamma(a) - std::lgamma(b) + a * std::log(x) + b * std::log(1.0 - x);
+			if (x < (a + 1.0) / (a + b + 2.0))
+				return std::exp(logFront) * BetaContinuedFraction(a, b, x) / a;
+			return 1.0 - std::exp(logFront) * BetaContinuedFraction(b, a, 1.0 - x) / b;
+		}
+
+		/* Upper tail probability P(T > t) of Student's t distribution with df degrees of freedom */
+		double StudentUpperTail(double t, double df) noexcept
+		{
+			const double tail = 0.5 * IncompleteBeta(df / 2.0, 0.5, df / (df + t * t));
+			return t > 0.0 ? tail : 1.0 - tail;
+		}
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	std::string BenchmarkBaseline::MakeKey(const std::string& group, const std::string& section, const std::string& name)
+	{
+		return group + '\t' + section + '\t' + name;
+	}
+
+	bool BenchmarkBaseline::Load(const std::filesystem::path& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			return false;
+
+		entries_.clear();
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (line.empty() || line.front() == '#')
+				continue;
+
+			std::istringstream iss(line);
+			std::string group, section, name;
+			BenchmarkStats stats{};
+			if (!std::getline(iss, group, '\t') || !std::getline(iss, section, '\t') || !std::getline(iss, name, '\t'))
+				continue;
+			if (!(iss >> stats.samples >> stats.median >> stats.mad >> stats.mean >> stats.stddev))
+				continue;
+
+			entries_[BenchmarkBaseline::MakeKey(group, section, name)] = stats;
+		}
+		return true;
+	}
+
+	bool BenchmarkBaseline::Save(const std::filesystem::path& path) const
+	{
+		std::ofstream file(path, std::ios::trunc);
+		if (!file)
+			return false;
+
+		file << "# group\tsection\tcase\tsamples\tmedian_ns\tmad_ns\tmean_ns\tstddev_ns\n";
+		file << std::setprecision(6) << std::scientific;
+		for (const auto& [key, stats] : entries_)
+		{
+			file << key
+				<< '\t' << stats.samples
+				<< '\t' << stats.median
+				<< '\t' << stats.mad
+				<< '\t' << stats.mean
+				<< '\t' << stats.stddev
+				<< '\n';
+		}
+		return static_cast<bool>(file);
+	}
+
+	const BenchmarkStats* BenchmarkBaseline::Find(const BenchmarkCase& benchmarkCase) const
+	{
+		auto it = entries_.find(BenchmarkBaseline::MakeKey(benchmarkCase.GetGroupName(), benchmarkCase.GetSectionName(), benchmarkCase.GetCaseName()));
+		return it == entries_.end() ? nullptr : &it->second;
+	}
+
+	void BenchmarkBaseline::Update(const BenchmarkCase& benchmarkCase)
+	{
+		entries_[BenchmarkBaseline::MakeKey(benchmarkCase.GetGroupName(), benchmarkCase.GetSectionName(), benchmarkCase.GetCaseName())] = benchmarkCase.GetStats();
+	}
+
+	BaselineComparison BenchmarkBaseline::Compare(const BenchmarkStats& baseline, const BenchmarkStats& current, double threshold, double significance) noexcept
+	{
+		BaselineComparison comparison{};
+		comparison.hasBaseline = true;
+		if (baseline.median <= 0.0 || baseline.samples < 2 || current.samples < 2)
+			return comparison;
+
+		comparison.change = (current.median - baseline.median) / baseline.median;
+
+		// one-sided Welch's t-test, H1: current mean > baseline mean
+		const double varBaseline = baseline.stddev * baseline.stddev / static_cast<double>(baseline.samples);
+		const double varCurrent = current.stddev * current.stddev / static_cast<double>(current.samples);
+		const double standardError = std::sqrt(varBaseline + varCurrent);
+		if (standardError <= 0.0)
+			comparison.pValue = current.mean > baseline.mean ? 0.0 : 1.0;
+		else
+		{
+			const double t = (current.mean - baseline.mean) / standardError;
+			const double df = (varBaseline + varCurrent) * (varBaseline + varCurrent) /
+				(varBaseline * varBaseline / static_cast<double>(baseline.samples - 1) + varCurrent * varCurrent / static_cast<double>(current.samples - 1));
+			comparison.pValue = StudentUpperTail(t, std::max(df, 1.0));
+		}
+
+		comparison.isRegressed = comparison.change > threshold && comparison.pValue < significance;
+		return comparison;
+	}
+}; // end of namespace winxframe
@@ -0,0 +1,141 @@
+/*!
+lib\source\TestSuite\ChildProcess.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Child Process source file.
+*/
+
+#include <TestSuite/ChildProcess.hpp>
+#include <win32/Error/error_macros.hpp>
+
+namespace winxframe
+{
+	/* CONSTRUCTOR */
+
+	ChildProcess::ChildProcess(const std::wstring& arguments)
+	{
+		std::wstring modulePath(MAX_PATH, L'\0');
+		for (;;)
+		{
+			const DWORD length = GetModuleFileNameW(nullptr, modulePath.data(), static_cast<DWORD>(modulePath.size()));
+			THROW_IF_ERROR_CTX(length == 0, L"ChildProcess::ChildProcess() : Failed to get the module file name!");
+			if (length < modulePath.size())
+			{
+				modulePath.resize(length);
+				break;
+			}
+			modulePath.resize(modulePath.size() * 2);
+		}
+
+		SECURITY_ATTRIBUTES securityAttributes{ sizeof(SECURITY_ATTRIBUTES), nullptr, TRUE };
+		HANDLE writePipe = nullptr;
+		THROW_IF_ERROR_CTX(!CreatePipe(&readPipe_, &writePipe, &securityAttributes, 0), L"ChildProcess::ChildProcess() : Failed to create the pipe!");
+		SetHandleInformation(readPipe_, HANDLE_FLAG_INHERIT, 0);
+
+		// restrict inheritance to this child's write end, otherwise children launched concurrently would hold each other's pipes open
+		SIZE_T attributeSize{};
+		InitializeProcThreadAttributeList(nullptr, 1, 0, &attributeSize);
+		std::vector<std::byte> attributeBuffer(attributeSize);
+		LPPROC_THREAD_ATTRIBUTE_LIST attributeList = reinterpret_cast<LPPROC_THREAD_ATTRIBUTE_LIST>(attributeBuffer.data());
+		BOOL isCreated = InitializeProcThreadAttributeList(attributeList, 1, 0, &attributeSize) &&
+			UpdateProcThreadAttribute(attributeList, 0, PROC_THREAD_ATTRIBUTE_HANDLE_LIST, &writePipe, sizeof(HANDLE), nullptr, nullptr);
+
+		std::wstring commandLine = L"\"" + modulePath + L"\" " + arguments + L" --test-child-pipe=" + std::to_wstring(reinterpret_cast<std::uintptr_t>(writePipe));
+		STARTUPINFOEXW startupInfo{};
+		startupInfo.StartupInfo.cb = sizeof(STARTUPINFOEXW);
+		startupInfo.lpAttributeList = attributeList;
+		PROCESS_INFORMATION processInfo{};
+		if (isCreated)
+			isCreated = CreateProcessW(nullptr, commandLine.data(), nullptr, nullptr, TRUE, EXTENDED_STARTUPINFO_PRESENT | CREATE_NO_WINDOW,
+				nullptr, nullptr, &startupInfo.StartupInfo, &processInfo);
+		const DWORD lastError = GetLastError();
+
+		DeleteProcThreadAttributeList(attributeList);
+		CloseHandle(writePipe);	// the child holds the only remaining write end, so the pipe reports EOF once the child exits
+		if (!isCreated)
+		{
+			this->Close();
+			SetLastError(lastError);
+			THROW_ERROR_CTX(L"ChildProcess::ChildProcess() : Failed to create the child process!");
+		}
+		CloseHandle(processInfo.hThread);
+		process_ = processInfo.hProcess;
+
+		reader_ = std::thread([this]
+			{
+				char buffer[4096];
+				DWORD bytesRead{};
+				while (ReadFile(readPipe_, buffer, sizeof(buffer), &bytesRead, nullptr) && bytesRead > 0)
+					output_.append(buffer, bytesRead);
+			}
+		);
+	}
+
+	/* DESTRUCTOR */
+
+	ChildProcess::~ChildProcess()
+	{
+		if (process_ && WaitForSingleObject(process_, 0) == WAIT_TIMEOUT)
+			TerminateProcess(process_, static_cast<UINT>(EXIT_FAILURE));
+		if (reader_.joinable())
+			reader_.join();
+		this->Close();
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void ChildProcess::Close() noexcept
+	{
+		if (readPipe_)
+			CloseHandle(readPipe_);
+		if (process_)
+			CloseHandle(process_);
+		readPipe_ = nullptr;
+		process_ = nullptr;
+	}
+
+	bool ChildProcess::Wait(std::chrono::milliseconds timeout)
+	{
+		const DWORD milliseconds = static_cast<DWORD>(std::min<std::chrono::milliseconds::rep>(timeout.count(), INFINITE - 1));
+		const bool isExited = WaitForSingleObject(process_, milliseconds) == WAIT_OBJECT_0;
+		if (!isExited)
+		{
+			TerminateProcess(process_, WAIT_TIMEOUT);
+			WaitForSingleObject(process_, INFINITE);
+		}
+		if (reader_.joinable())
+			reader_.join();
+		return isExited;
+	}
+
+	DWORD ChildProcess::GetExitCode() const noexcept
+	{
+		DWORD exitCode = STILL_ACTIVE;
+		GetExitCodeProcess(process_, &exitCode);
+		return exitCode;
+	}
+
+	std::string ChildProcess::ExitCodeName(DWORD exitCode)
+	{
+		switch (exitCode)
+		{
+		case 0x00000003: return "abort()";
+		case 0x80000003: return "EXCEPTION_BREAKPOINT";
+		case 0xC0000005: return "EXCEPTION_ACCESS_VIOLATION";
+		case 0xC0000006: return "EXCEPTION_IN_PAGE_ERROR";
+		case 0xC000001D: return "EXCEPTION_ILLEGAL_INSTRUCTION";
+		case 0xC000008C: return "EXCEPTION_ARRAY_BOUNDS_EXCEEDED";
+		case 0xC000008E: return "EXCEPTION_FLT_DIVIDE_BY_ZERO";
+		case 0xC0000094: return "EXCEPTION_INT_DIVIDE_BY_ZERO";
+		case 0xC0000095: return "EXCEPTION_INT_OVERFLOW";
+		case 0xC0000096: return "EXCEPTION_PRIV_INSTRUCTION";
+		case 0xC00000FD: return "EXCEPTION_STACK_OVERFLOW";
+		case 0xC0000374: return "STATUS_HEAP_CORRUPTION";
+		case 0xC0000409: return "STATUS_STACK_BUFFER_OVERRUN";
+		case 0xE06D7363: return "unhandled C++ exception";
+		default: return "";
+		}
+	}
+}; // end of namespace winxframe
@@ -0,0 +1,54 @@
+/*!
+lib\source\TestSuite\ParameterizedCase.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Parameterized Case source file.
+*/
+
+#include <TestSuite/ParameterizedCase.hpp>
+
+namespace winxframe
+{
+	namespace test_params
+	{
+		/* FUNCTION DEFINITIONS */
+
+		std::vector<std::string> SplitTypeNames(std::string_view typeNames)
+		{
+			std::vector<std::string> names;
+			auto trim = [](std::string_view text)
+				{
+					const std::size_t first = text.find_first_not_of(" \t\r\n");
+					const std::size_t last = text.find_last_not_of(" \t\r\n");
+					return first == std::string_view::npos ? std::string{} : std::string(text.substr(first, last - first + 1));
+				};
+
+			int depth = 0;
+			std::size_t begin = 0;
+			for (std::size_t i = 0; i < typeNames.size(); ++i)
+			{
+				const char ch = typeNames[i];
+				if (ch == '<' || ch == '(' || ch == '[')
+					++depth;
+				else if (ch == '>' || ch == ')' || ch == ']')
+					--depth;
+				else if (ch == ',' && depth == 0)
+				{
+					names.push_back(trim(typeNames.substr(begin, i - begin)));
+					begin = i + 1;
+				}
+			}
+			names.push_back(trim(typeNames.substr(begin)));
+			return names;
+		}
+
+		std::string TypeCaseName(const std::string& name, const std::vector<std::string>& typeNames, std::size_t typeCount, std::size_t index, const char* typeidName)
+		{
+			// a type list produced by another macro stringizes unexpanded and cannot be matched to the instantiations
+			const bool isSpelled = typeNames.size() == typeCount && !typeNames[index].empty();
+			return name + '<' + (isSpelled ? typeNames[index] : std::string(typeidName)) + '>';
+		}
+	}; // end of namespace test_params
+}; // end of namespace winxframe
@@ -0,0 +1,71 @@
+/*!
+lib\source\TestSuite\ReportBuffer.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Report Buffer source file.
+*/
+
+#include <TestSuite/ReportBuffer.hpp>
+#include <win32/framework.h>
+#include <win32/Console/ConsoleColor.hpp>
+
+namespace winxframe
+{
+	/* CONSTRUCTOR */
+
+	ReportBuffer::ReportBuffer(std::size_t capacity) :
+		std::ostream(nullptr)
+	{
+		buffer_.Get().reserve(capacity);
+		this->rdbuf(&buffer_);
+		if (ReportBuffer::EnableVirtualTerminal())
+			*this << console_color::ansi;
+		else
+			*this << console_color::plain;
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	ReportBuffer::StringBuffer::int_type ReportBuffer::StringBuffer::overflow(int_type ch)
+	{
+		if (!traits_type::eq_int_type(ch, traits_type::eof()))
+			buffer_.push_back(traits_type::to_char_type(ch));
+		return traits_type::not_eof(ch);
+	}
+
+	std::streamsize ReportBuffer::StringBuffer::xsputn(const char_type* s, std::streamsize count)
+	{
+		buffer_.append(s, static_cast<std::size_t>(count));
+		return count;
+	}
+
+	bool ReportBuffer::EnableVirtualTerminal() noexcept
+	{
+		static const bool isEnabled = []
+			{
+				HANDLE hOutput = GetStdHandle(STD_OUTPUT_HANDLE);
+				DWORD mode{};
+				if (hOutput == INVALID_HANDLE_VALUE || !GetConsoleMode(hOutput, &mode))
+					return false;
+				return (mode & ENABLE_VIRTUAL_TERMINAL_PROCESSING) || SetConsoleMode(hOutput, mode | ENABLE_VIRTUAL_TERMINAL_PROCESSING);
+			}();
+		return isEnabled;
+	}
+
+	void ReportBuffer::Flush()
+	{
+		std::string& text = buffer_.Get();
+		if (text.empty())
+			return;
+
+		// anything already queued in std::cout must come first
+		std::cout.flush();
+		HANDLE hOutput = GetStdHandle(STD_OUTPUT_HANDLE);
+		DWORD bytesWritten{};
+		if (hOutput == INVALID_HANDLE_VALUE || !hOutput || !WriteFile(hOutput, text.data(), static_cast<DWORD>(text.size()), &bytesWritten, nullptr))
+			std::cout.write(text.data(), static_cast<std::streamsize>(text.size())).flush();
+		text.clear();
+	}
+}; // end of namespace winxframe
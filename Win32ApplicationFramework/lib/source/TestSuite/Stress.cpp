@@ -0,0 +1,107 @@
+/*!
+lib\source\TestSuite\Stress.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Stress source file.
+*/
+
+#include <TestSuite/Stress.hpp>
+#include <barrier>
+
+namespace winxframe
+{
+	namespace
+	{
+		/* Collects the checks of one stress thread, so threads never share counters or the failure log */
+		class StressSink final : public TestRegistry::TestCase
+		{
+		public:
+			explicit StressSink(const TestRegistry::TestCase& owner) : TestCase(Unregistered{}, owner.GetCaseName(), owner.GetGroupName(), owner.GetSectionName()) {}
+			virtual void Run() override {}
+		};
+	}
+
+	/* CONSTRUCTOR */
+
+	StressCase::StressCase(const std::string& name, std::size_t threadCount, std::uint64_t iterations, const std::string& group, const std::string& section) :
+		TestCase(name, group, section),
+		threadCount_(threadCount == 0 ? std::max(1u, std::thread::hardware_concurrency()) : threadCount),
+		iterations_(iterations)
+	{
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void StressCase::Run()
+	{
+		levels_.clear();
+		for (std::size_t threads = 1; ; threads = std::min(threads * 2, threadCount_))
+		{
+			levels_.push_back(this->RunLevel(threads));
+			if (threads == threadCount_)
+				break;
+		}
+	}
+
+	StressLevel StressCase::RunLevel(std::size_t threads)
+	{
+		TraceScope traceScope(std::to_string(threads) + " thread(s)", "stress");
+
+		std::vector<std::unique_ptr<StressSink>> sinks;
+		sinks.reserve(threads);
+		for (std::size_t i = 0; i < threads; ++i)
+			sinks.push_back(std::make_unique<StressSink>(*this));
+
+		// each worker times itself, the level spans from the first worker released to the last one finished
+		using time_point = std::chrono::time_point<std::chrono::high_resolution_clock>;
+		std::vector<time_point> starts(threads), stops(threads);
+		std::barrier startBarrier(static_cast<std::ptrdiff_t>(threads));
+		std::vector<std::thread> workers;
+		workers.reserve(threads);
+		for (std::size_t i = 0; i < threads; ++i)
+		{
+			workers.emplace_back([this, &startBarrier, &sinks, &starts, &stops, i]
+				{
+					TestRegistry::currentCasePtr_ = sinks[i].get();
+					startBarrier.arrive_and_wait();
+					starts[i] = std::chrono::high_resolution_clock::now();
+					try
+					{
+						this->RunThread(i, iterations_);
+					}
+					catch (const std::exception& e)
+					{
+						sinks[i]->LogCaseFail("thread " + std::to_string(i) + " threw " + e.what());
+					}
+					catch (...)
+					{
+						sinks[i]->LogCaseFail("thread " + std::to_string(i) + " threw an unknown exception");
+					}
+					stops[i] = std::chrono::high_resolution_clock::now();
+					TestRegistry::currentCasePtr_ = nullptr;
+					if (TraceWriter* trace = TraceWriter::Active())
+						trace->WriteComplete("thread " + std::to_string(i), "stress", starts[i], stops[i]);
+				}
+			);
+		}
+
+		for (std::thread& worker : workers)
+			worker.join();
+		const time_point start = *std::min_element(starts.begin(), starts.end());
+		const time_point stop = *std::max_element(stops.begin(), stops.end());
+
+		std::uintmax_t testsChecked = this->GetTestsChecked(), testsPassed = this->GetTestsPassed();
+		std::string failureLog = this->GetFailureLog();
+		for (const std::unique_ptr<StressSink>& sink : sinks)
+		{
+			testsChecked += sink->GetTestsChecked();
+			testsPassed += sink->GetTestsPassed();
+			failureLog += sink->GetFailureLog();
+		}
+		this->SetResult(testsChecked, testsPassed, failureLog);
+
+		return StressLevel{ threads, iterations_ * threads, stop - start };
+	}
+}; // end of namespace winxframe
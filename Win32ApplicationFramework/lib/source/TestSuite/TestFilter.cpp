@@ -0,0 +1,74 @@
+/*!
+lib\source\TestSuite\TestFilter.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test Filter source file.
+*/
+
+#include <TestSuite/TestFilter.hpp>
+#include <win32/framework.h>
+#include <utils/string_utils.hpp>
+#include <stdexcept>
+
+namespace winxframe
+{
+	/* CONSTRUCTOR */
+
+	TestFilter::TestFilter(const std::string& filter)
+	{
+		std::size_t begin = 0;
+		while (begin <= filter.size())
+		{
+			std::size_t end = filter.find(',', begin);
+			if (end == std::string::npos)
+				end = filter.size();
+
+			std::string token = filter.substr(begin, end - begin);
+			begin = end + 1;
+			if (token.empty())
+				continue;
+
+			Pattern pattern{};
+			if (token.front() == '-')
+			{
+				pattern.isExclusion = true;
+				token.erase(0, 1);
+			}
+			if (token.rfind("re:", 0) == 0)
+			{
+				try
+				{
+					pattern.regex.emplace(token.substr(3), std::regex::ECMAScript | std::regex::optimize);
+				}
+				catch (const std::regex_error& e)
+				{
+					throw std::invalid_argument("TestFilter: invalid regular expression \"" + token.substr(3) + "\": " + e.what());
+				}
+			}
+			else
+				pattern.glob = token;
+
+			hasInclusion_ |= !pattern.isExclusion;
+			patterns_.push_back(std::move(pattern));
+		}
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	bool TestFilter::Matches(const std::string& name) const
+	{
+		bool isIncluded = !hasInclusion_;
+		for (const Pattern& pattern : patterns_)
+		{
+			const bool isMatch = pattern.regex ? std::regex_match(name, *pattern.regex) : string_utils::GlobMatch(pattern.glob, name);
+			if (!isMatch)
+				continue;
+			if (pattern.isExclusion)
+				return false;
+			isIncluded = true;
+		}
+		return isIncluded;
+	}
+}; // end of namespace winxframe
@@ -0,0 +1,103 @@
+/*!
+lib\source\TestSuite\TestHistory.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test History source file.
+*/
+
+#include <TestSuite/TestHistory.hpp>
+
+namespace winxframe
+{
+	/* FUNCTION DEFINITIONS */
+
+	std::string TestHistory::MakeKey(const TestRegistry::TestCase& testCase)
+	{
+		return testCase.GetGroupName() + '\t' + testCase.GetSectionName() + '\t' + testCase.GetCaseName();
+	}
+
+	bool TestHistory::Load(const std::filesystem::path& path)
+	{
+		std::ifstream file(path);
+		if (!file)
+			return false;
+
+		entries_.clear();
+		std::string line;
+		while (std::getline(file, line))
+		{
+			if (line.empty() || line.front() == '#')
+				continue;
+
+			std::istringstream iss(line);
+			std::string group, section, name;
+			std::chrono::nanoseconds::rep elapsed{};
+			int isFailed{};
+			if (!std::getline(iss, group, '\t') || !std::getline(iss, section, '\t') || !std::getline(iss, name, '\t'))
+				continue;
+			if (!(iss >> elapsed >> isFailed))
+				continue;
+
+			entries_[group + '\t' + section + '\t' + name] = TestHistoryEntry{ std::chrono::nanoseconds(elapsed), isFailed != 0 };
+		}
+		return true;
+	}
+
+	bool TestHistory::Save(const std::filesystem::path& path) const
+	{
+		std::ofstream file(path, std::ios::trunc);
+		if (!file)
+			return false;
+
+		file << "# group\tsection\tcase\telapsed_ns\tfailed\n";
+		for (const auto& [key, entry] : entries_)
+		{
+			file << key
+				<< '\t' << entry.elapsed.count()
+				<< '\t' << (entry.isFailed ? 1 : 0)
+				<< '\n';
+		}
+		return static_cast<bool>(file);
+	}
+
+	const TestHistoryEntry* TestHistory::Find(const TestRegistry::TestCase& testCase) const
+	{
+		auto it = entries_.find(TestHistory::MakeKey(testCase));
+		return it == entries_.end() ? nullptr : &it->second;
+	}
+
+	void TestHistory::Update(const TestRegistry::TestCase& testCase, bool isFailed)
+	{
+		entries_[TestHistory::MakeKey(testCase)] = TestHistoryEntry{ testCase.GetCaseElapsed(), isFailed };
+	}
+
+	void TestHistory::Schedule(std::vector<TestRegistry::TestCase*>& testCases) const
+	{
+		// look every case up once instead of on each comparison
+		struct Key
+		{
+			int rank;	// 0 failed last time, 1 no history, 2 passed last time
+			std::chrono::nanoseconds elapsed;
+			TestRegistry::TestCase* testCase;
+		};
+		std::vector<Key> keys;
+		keys.reserve(testCases.size());
+		for (TestRegistry::TestCase* testCase : testCases)
+		{
+			const TestHistoryEntry* entry = this->Find(*testCase);
+			keys.push_back({ !entry ? 1 : entry->isFailed ? 0 : 2, entry ? entry->elapsed : std::chrono::nanoseconds{}, testCase });
+		}
+
+		std::stable_sort(keys.begin(), keys.end(), [](const Key& lhs, const Key& rhs)
+			{
+				if (lhs.rank != rhs.rank)
+					return lhs.rank < rhs.rank;
+				return lhs.elapsed > rhs.elapsed;
+			}
+		);
+		for (std::size_t i = 0; i < keys.size(); ++i)
+			testCases[i] = keys[i].testCase;
+	}
+}; // end of namespace winxframe
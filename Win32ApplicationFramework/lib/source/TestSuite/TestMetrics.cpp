@@ -0,0 +1,94 @@
+/*!
+lib\source\TestSuite\TestMetrics.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test Metrics source file.
+*/
+
+#include <TestSuite/TestMetrics.hpp>
+#include <win32/framework.h>
+#include <psapi.h>	// GetProcessMemoryInfo()
+#include <atomic>
+
+namespace winxframe
+{
+	namespace
+	{
+		std::atomic<PerfCounterSource> perfCounterSource{ nullptr };
+	}
+
+	/* OPERATOR OVERLOADS */
+
+	PerfCounterValues& PerfCounterValues::operator += (const PerfCounterValues& other) noexcept
+	{
+		auto add = [](std::optional<std::uint64_t>& lhs, const std::optional<std::uint64_t>& rhs) { if (rhs) lhs = lhs.value_or(0) + *rhs; };
+		add(cycles, other.cycles);
+		add(instructions, other.instructions);
+		add(branchMisses, other.branchMisses);
+		add(l1dMisses, other.l1dMisses);
+		add(llcMisses, other.llcMisses);
+		return *this;
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void PerfCounters::SetSource(PerfCounterSource source) noexcept
+	{
+		perfCounterSource.store(source, std::memory_order_release);
+	}
+
+	PerfCounterValues PerfCounters::Read() noexcept
+	{
+		PerfCounterValues values{};
+		if (const PerfCounterSource source = perfCounterSource.load(std::memory_order_acquire))
+			source(values);
+		ULONG64 cycles{};
+		if (QueryThreadCycleTime(GetCurrentThread(), &cycles))
+			values.cycles = cycles;
+		return values;
+	}
+
+	PerfCounterValues PerfCounters::Stop() const noexcept
+	{
+		const PerfCounterValues stop = PerfCounters::Read();
+		auto delta = [](const std::optional<std::uint64_t>& end, const std::optional<std::uint64_t>& begin) -> std::optional<std::uint64_t>
+			{
+				if (!end || !begin) return std::nullopt;
+				return *end - *begin;
+			};
+
+		PerfCounterValues values{};
+		values.cycles = delta(stop.cycles, start_.cycles);
+		values.instructions = delta(stop.instructions, start_.instructions);
+		values.branchMisses = delta(stop.branchMisses, start_.branchMisses);
+		values.l1dMisses = delta(stop.l1dMisses, start_.l1dMisses);
+		values.llcMisses = delta(stop.llcMisses, start_.llcMisses);
+		return values;
+	}
+
+	namespace metrics
+	{
+		/* FUNCTION DEFINITIONS */
+
+		std::chrono::nanoseconds ThreadCpuTime() noexcept
+		{
+			FILETIME creationTime{}, exitTime{}, kernelTime{}, userTime{};
+			if (!GetThreadTimes(GetCurrentThread(), &creationTime, &exitTime, &kernelTime, &userTime))
+				return std::chrono::nanoseconds{};
+
+			// FILETIME counts 100 nanosecond intervals
+			auto toTicks = [](const FILETIME& time) { return (static_cast<std::uint64_t>(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+			return std::chrono::nanoseconds((toTicks(kernelTime) + toTicks(userTime)) * 100);
+		}
+
+		std::uint64_t PeakWorkingSet() noexcept
+		{
+			PROCESS_MEMORY_COUNTERS counters{};
+			if (!GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters)))
+				return 0;
+			return static_cast<std::uint64_t>(counters.PeakWorkingSetSize);
+		}
+	}; // end of namespace metrics
+}; // end of namespace winxframe
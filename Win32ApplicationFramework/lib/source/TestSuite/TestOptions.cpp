@@ -0,0 +1,154 @@
+/*!
+lib\source\TestSuite\TestOptions.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Test Options source file.
+*/
+
+#include <TestSuite/TestOptions.hpp>
+#include <win32/framework.h>
+#include <utils/string_utils.hpp>
+#include <shellapi.h>	// CommandLineToArgvW()
+
+namespace winxframe
+{
+	namespace
+	{
+		std::size_t ParseCount(const std::string& name, const std::string& value)
+		{
+			std::size_t count{};
+			std::size_t parsed{};
+			try
+			{
+				count = static_cast<std::size_t>(std::stoull(value, &parsed));
+			}
+			catch (const std::exception&)
+			{
+				parsed = 0;
+			}
+			if (parsed == 0 || parsed != value.size() || value.front() == '-')
+				throw std::invalid_argument("TestOptions: " + name + " expects a non-negative integer, got \"" + value + "\"");
+			return count;
+		}
+
+		bool GetEnvironment(const char* name, std::string& value)
+		{
+			const DWORD length = GetEnvironmentVariableA(name, nullptr, 0);
+			if (length == 0)
+				return false;
+
+			std::string buffer(length, '\0');
+			const DWORD written = GetEnvironmentVariableA(name, buffer.data(), length);
+			if (written == 0 || written >= length)
+				return false;
+
+			buffer.resize(written);
+			value = std::move(buffer);
+			return true;
+		}
+
+		void ValidateShard(std::size_t shardIndex, std::size_t shardCount)
+		{
+			if (shardCount == 0)
+				throw std::invalid_argument("TestOptions: shard count must be at least 1");
+			if (shardIndex >= shardCount)
+				throw std::invalid_argument("TestOptions: shard index " + std::to_string(shardIndex) + " is out of range for " + std::to_string(shardCount) + " shard(s)");
+		}
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void TestOptions::ApplyEnvironment()
+	{
+		std::string value;
+		if (GetEnvironment("WINXFRAME_TEST_GROUP", value)) groupFilter = value;
+		if (GetEnvironment("WINXFRAME_TEST_SECTION", value)) sectionFilter = value;
+		if (GetEnvironment("WINXFRAME_TEST_CASE", value)) caseFilter = value;
+		if (GetEnvironment("WINXFRAME_TEST_SHARD_INDEX", value)) shardIndex = ParseCount("WINXFRAME_TEST_SHARD_INDEX", value);
+		if (GetEnvironment("WINXFRAME_TEST_SHARD_COUNT", value)) shardCount = ParseCount("WINXFRAME_TEST_SHARD_COUNT", value);
+		if (GetEnvironment("WINXFRAME_TEST_PARALLEL", value)) parallel = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_JOBS", value))
+		{
+			jobs = ParseCount("WINXFRAME_TEST_JOBS", value);
+			parallel = true;
+		}
+		if (GetEnvironment("WINXFRAME_TEST_ISOLATE", value)) isolated = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_TIMEOUT", value)) caseTimeout = std::chrono::milliseconds(ParseCount("WINXFRAME_TEST_TIMEOUT", value));
+		if (GetEnvironment("WINXFRAME_TEST_INSTRUMENT", value)) instrument = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_HISTORY", value)) historyPath = value;
+		if (GetEnvironment("WINXFRAME_TEST_BASELINE", value)) baselinePath = value;
+		if (GetEnvironment("WINXFRAME_TEST_UPDATE_BASELINE", value)) updateBaseline = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_FAIL_FAST", value)) failFast = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_TRACE", value)) tracePath = value;
+		if (GetEnvironment("WINXFRAME_TEST_ACCURACY_SAMPLES", value)) accuracySamples = ParseCount("WINXFRAME_TEST_ACCURACY_SAMPLES", value);
+		if (GetEnvironment("WINXFRAME_TEST_BENCHMARKS", value)) runBenchmarks = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_STRESS", value)) runStress = value != "0";
+		if (GetEnvironment("WINXFRAME_TEST_ACCURACY", value)) runAccuracy = value != "0";
+		ValidateShard(shardIndex, shardCount);
+	}
+
+	void TestOptions::ApplyArguments(const std::vector<std::string>& arguments)
+	{
+		for (const std::string& argument : arguments)
+		{
+			const std::size_t equals = argument.find('=');
+			const std::string key = argument.substr(0, equals);
+			const std::string value = equals == std::string::npos ? std::string{} : argument.substr(equals + 1);
+
+			if (key == "--test-group") groupFilter = value;
+			else if (key == "--test-section") sectionFilter = value;
+			else if (key == "--test-case") caseFilter = value;
+			else if (key == "--test-shard-index") shardIndex = ParseCount(key, value);
+			else if (key == "--test-shard-count") shardCount = ParseCount(key, value);
+			else if (key == "--test-jobs")
+			{
+				jobs = ParseCount(key, value);
+				parallel = true;
+			}
+			else if (key == "--test-parallel") parallel = true;
+			else if (key == "--test-serial") parallel = false;
+			else if (key == "--test-isolate") isolated = true;
+			else if (key == "--test-timeout") caseTimeout = std::chrono::milliseconds(ParseCount(key, value));
+			else if (key == "--test-instrument") instrument = true;
+			else if (key == "--test-history") historyPath = value;
+			else if (key == "--test-baseline") baselinePath = value;
+			else if (key == "--test-update-baseline") updateBaseline = true;
+			else if (key == "--test-fail-fast") failFast = true;
+			else if (key == "--test-trace") tracePath = value;
+			else if (key == "--test-accuracy-samples") accuracySamples = ParseCount(key, value);
+			else if (key == "--test-benchmarks") runBenchmarks = true;
+			else if (key == "--test-stress") runStress = true;
+			else if (key == "--test-accuracy") runAccuracy = true;
+			else if (key == "--test-child") childCaseIndex = ParseCount(key, value);
+			else if (key == "--test-child-pipe") childPipe = static_cast<std::uintptr_t>(ParseCount(key, value));
+			else if (key == "--test-shard")
+			{
+				// --test-shard=i/n
+				const std::size_t slash = value.find('/');
+				if (slash == std::string::npos)
+					throw std::invalid_argument("TestOptions: --test-shard expects \"index/count\", got \"" + value + "\"");
+				shardIndex = ParseCount(key, value.substr(0, slash));
+				shardCount = ParseCount(key, value.substr(slash + 1));
+			}
+		}
+		ValidateShard(shardIndex, shardCount);
+	}
+
+	void TestOptions::ApplyCommandLine()
+	{
+		int argc{};
+		LPWSTR* argv = CommandLineToArgvW(GetCommandLineW(), &argc);
+		if (!argv)
+			return;
+
+		// skip the program name
+		std::vector<std::string> arguments;
+		for (int i = 1; i < argc; ++i)
+			arguments.push_back(string_utils::ToNarrow(argv[i]));
+		LocalFree(argv);
+
+		this->ApplyArguments(arguments);
+	}
+}; // end of namespace winxframe
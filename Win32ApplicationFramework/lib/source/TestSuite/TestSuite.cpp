@@ -1,22 +1,112 @@
 /*!
 lib\source\TestSuite\TestSuite.cpp
 Created: October 21, 2025
-Updated: November 27, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Test Suite source file.
 */
 
 #include <TestSuite/TestSuite.hpp>
+#include <TestSuite/WorkStealingPool.hpp>
+#include <TestSuite/Benchmark.hpp>
+#include <TestSuite/Stress.hpp>
+#include <TestSuite/Accuracy.hpp>
+#include <TestSuite/BenchmarkBaseline.hpp>
+#include <TestSuite/TestFilter.hpp>
+#include <TestSuite/ChildProcess.hpp>
+#include <TestSuite/ReportBuffer.hpp>
+#include <TestSuite/TestHistory.hpp>
+#include <crtdbg.h>
 #include <win32/Error/error_macros.hpp>
 #include <win32/Console/ConsoleColor.hpp>
 #include <utils/string_utils.hpp>
 #include <utils/stream_utils.hpp>
-#include <utils/container_utils.hpp>
 #include <utils/time_utils.hpp>
+#include <atomic>
+#include <unordered_set>
 
 namespace winxframe
 {
+	namespace
+	{
+		/* Child process report fields for an optional counter, '-' when the counter is unavailable */
+		void WriteCounter(std::ostream& os, const std::optional<std::uint64_t>& counter)
+		{
+			if (counter)
+				os << ' ' << *counter;
+			else
+				os << " -";
+		}
+
+		bool ReadCounter(std::istream& is, std::optional<std::uint64_t>& counter)
+		{
+			std::string token;
+			if (!(is >> token))
+				return false;
+			counter.reset();
+			if (token != "-")
+				counter = std::stoull(token);
+			return true;
+		}
+
+		void WriteCaseMetrics(std::ostream& os, const CaseMetrics& caseMetrics)
+		{
+			os << caseMetrics.isMeasured << ' ' << caseMetrics.allocationStats.allocations << ' ' << caseMetrics.allocationStats.deallocations << ' '
+				<< caseMetrics.allocationStats.bytesAllocated << ' ' << caseMetrics.allocationStats.peakLiveBytes << ' ' << caseMetrics.cpuTime.count() << ' '
+				<< caseMetrics.peakWorkingSet;
+			WriteCounter(os, caseMetrics.counters.cycles);
+			WriteCounter(os, caseMetrics.counters.instructions);
+			WriteCounter(os, caseMetrics.counters.branchMisses);
+			WriteCounter(os, caseMetrics.counters.l1dMisses);
+			WriteCounter(os, caseMetrics.counters.llcMisses);
+		}
+
+		/* A case fails when any of its checks failed or it made no checks at all */
+		bool IsCaseFailed(const TestRegistry::TestCase* testCase) noexcept
+		{
+			return testCase->GetTestsPassed() != testCase->GetTestsChecked() || testCase->GetTestsChecked() == 0;
+		}
+
+		/* Formats a counter divided by a per-iteration divisor, blank when the counter is unavailable */
+		std::string FormatCounter(const std::optional<std::uint64_t>& counter, double divisor = 1.0)
+		{
+			if (!counter)
+				return std::string{};
+			std::ostringstream strCounter;
+			strCounter << std::setprecision(divisor == 1.0 ? 0 : 1) << std::fixed << static_cast<double>(*counter) / divisor;
+			return strCounter.str();
+		}
+
+		/* Formats instructions per cycle, blank unless both counters are available */
+		std::string FormatIPC(const PerfCounterValues& counters)
+		{
+			if (!counters.instructions || !counters.cycles || *counters.cycles == 0)
+				return std::string{};
+			std::ostringstream strIPC;
+			strIPC << std::setprecision(2) << std::fixed << static_cast<double>(*counters.instructions) / static_cast<double>(*counters.cycles);
+			return strIPC.str();
+		}
+
+		bool ReadCaseMetrics(std::istream& is, CaseMetrics& caseMetrics)
+		{
+			long long cpuTime{};
+			if (!(is >> caseMetrics.isMeasured >> caseMetrics.allocationStats.allocations >> caseMetrics.allocationStats.deallocations
+				>> caseMetrics.allocationStats.bytesAllocated >> caseMetrics.allocationStats.peakLiveBytes >> cpuTime >> caseMetrics.peakWorkingSet))
+				return false;
+			caseMetrics.cpuTime = std::chrono::nanoseconds(cpuTime);
+			try
+			{
+				return ReadCounter(is, caseMetrics.counters.cycles) && ReadCounter(is, caseMetrics.counters.instructions) && ReadCounter(is, caseMetrics.counters.branchMisses)
+					&& ReadCounter(is, caseMetrics.counters.l1dMisses) && ReadCounter(is, caseMetrics.counters.llcMisses);
+			}
+			catch (const std::exception&)
+			{
+				return false;
+			}
+		}
+	}
+
 	//////////////////////////////////////////////////
 	//	         TEST REGISTRY::TEST CASE	        //
 	//////////////////////////////////////////////////
@@ -29,7 +119,14 @@ namespace winxframe
 		sectionName_(section), 
 		caseWeight_(weight)
 	{
-		TestRegistry::CaseMap()[groupName_][sectionName_].push_back(this);
+		TestRegistry::Cases().Add(this);
+	}
+
+	TestRegistry::TestCase::TestCase(Unregistered, const std::string& name, const std::string& group, const std::string& section) :
+		caseName_(name),
+		groupName_(group),
+		sectionName_(section)
+	{
 	}
 
 	/* FUNCTION DEFINITIONS */
@@ -52,24 +149,146 @@ namespace winxframe
 			++testsPassed_;
 	}
 
-	void TestRegistry::TestCase::LogCheckFail(const char* const conditionString, const char* const file, int line) const noexcept
+	void TestRegistry::TestCase::CheckAllocations(const AllocationStats& stats, std::uint64_t maximum, const char* const codeString, const char* const file, int line)
+	{
+		++testsChecked_;
+		if (stats.allocations <= maximum)
+		{
+			++testsPassed_;
+			return;
+		}
+
+		std::ostringstream oss;
+		std::filesystem::path f = file;
+		oss << "File: " << f.filename().string() << ", Line: " << line << ", allocation check failed in " << this->GetCaseName() << ": " << codeString
+			<< " made " << stats.allocations << " allocation(s) totalling " << stats.bytesAllocated << " bytes, expected at most " << maximum << '\n';
+		this->AppendFailure(oss.str());
+	}
+
+	void TestRegistry::TestCase::LogCheckFail(const char* const conditionString, const char* const file, int line) noexcept
 	{
 		std::ostringstream oss;
 		std::filesystem::path f = file;
 		oss << "File: " << f.filename().string() << ", Line: " << line << ", check failed in " << this->GetCaseName() << ": " << conditionString << '\n';
-		std::cout << oss.str();
-		if (TestRegistry::logFile_.is_open())
-			TestRegistry::logFile_ << oss.str();
+		this->AppendFailure(oss.str());
 	}
 
-	void TestRegistry::TestCase::LogCheckFail(const std::string& message, const char* const file, int line) const noexcept
+	void TestRegistry::TestCase::LogCheckFail(const std::string& message, const char* const file, int line) noexcept
 	{
 		std::ostringstream oss;
 		std::filesystem::path f = file;
 		oss << "File: " << f.filename().string() << ", Line: " << line << ", check failed in " << this->GetCaseName() << ", with custom message: " << message << '\n';
-		std::cout << oss.str();
-		if (TestRegistry::logFile_.is_open())
-			TestRegistry::logFile_ << oss.str();
+		this->AppendFailure(oss.str());
+	}
+
+	void TestRegistry::TestCase::LogCaseFail(const std::string& reason) noexcept
+	{
+		// counts as one failed check so the case is reported as FAIL even if it never reached a CHECK
+		++testsChecked_;
+		std::ostringstream oss;
+		oss << "Case " << this->GetCaseName() << " failed: " << reason << '\n';
+		this->AppendFailure(oss.str());
+	}
+
+	void TestRegistry::TestCase::SetResult(std::uintmax_t testsChecked, std::uintmax_t testsPassed, const std::string& failureLog)
+	{
+		testsChecked_ = testsChecked;
+		testsPassed_ = testsPassed;
+		failureLog_ = failureLog;
+	}
+
+	void TestRegistry::TestCase::AppendFailure(const std::string& message) noexcept
+	{
+		// failures are buffered per case and flushed in report order once every case has run, keeping output deterministic in parallel mode
+		failureLog_ += message;
+	}
+
+	//////////////////////////////////////////////////
+	//	        TEST REGISTRY::CASE TABLE	        //
+	//////////////////////////////////////////////////
+
+	/* FUNCTION DEFINITIONS */
+
+	std::uint32_t TestRegistry::CaseTable::Intern(const std::string& name)
+	{
+		auto it = nameIds_.find(name);
+		if (it != nameIds_.end())
+			return it->second;
+
+		const std::uint32_t id = static_cast<std::uint32_t>(names_.size());
+		names_.push_back(name);
+		nameIds_.emplace(names_.back(), id);
+		return id;
+	}
+
+	void TestRegistry::CaseTable::Add(TestCase* testCase)
+	{
+		testCase->groupId_ = this->Intern(testCase->GetGroupName());
+		testCase->sectionId_ = this->Intern(testCase->GetSectionName());
+		entries_.push_back({ testCase->groupId_, testCase->sectionId_, static_cast<std::uint32_t>(entries_.size()), testCase });
+		isOrdered_ = false;
+	}
+
+	const std::vector<TestRegistry::TestCase*>& TestRegistry::CaseTable::Ordered()
+	{
+		if (isOrdered_)
+			return orderedCases_;
+
+		// rank the interned names alphabetically once, so the sorts below only compare integers
+		std::vector<std::uint32_t> nameRanks(names_.size());
+		{
+			std::vector<std::uint32_t> ids(names_.size());
+			for (std::uint32_t id = 0; id < ids.size(); ++id)
+				ids[id] = id;
+			std::sort(ids.begin(), ids.end(), [this](std::uint32_t a, std::uint32_t b) { return names_[a] < names_[b]; });
+			for (std::uint32_t rank = 0; rank < ids.size(); ++rank)
+				nameRanks[ids[rank]] = rank;
+		}
+
+		// group the entries by (group, section), keeping registration order within each section
+		std::vector<Entry> entries = entries_;
+		std::sort(entries.begin(), entries.end(),
+			[&nameRanks](const Entry& a, const Entry& b)
+			{
+				if (a.groupId != b.groupId) return nameRanks[a.groupId] < nameRanks[b.groupId];
+				if (a.sectionId != b.sectionId) return a.sectionId < b.sectionId;
+				return a.sequence < b.sequence;
+			}
+		);
+
+		// order the sections of each group by the CaseName of their first test case
+		struct SectionRun
+		{
+			std::uint32_t groupRank;
+			std::size_t begin;
+			std::size_t end;
+		};
+		std::vector<SectionRun> sectionRuns;
+		for (std::size_t begin = 0, end = 0; begin < entries.size(); begin = end)
+		{
+			while (end < entries.size() && entries[end].groupId == entries[begin].groupId && entries[end].sectionId == entries[begin].sectionId)
+				++end;
+			sectionRuns.push_back({ nameRanks[entries[begin].groupId], begin, end });
+		}
+		std::sort(sectionRuns.begin(), sectionRuns.end(),
+			[&entries](const SectionRun& a, const SectionRun& b)
+			{
+				if (a.groupRank != b.groupRank) return a.groupRank < b.groupRank;
+				const std::string& caseA = entries[a.begin].testCase->GetCaseName();
+				const std::string& caseB = entries[b.begin].testCase->GetCaseName();
+				if (caseA != caseB) return caseA < caseB;
+				return entries[a.begin].sectionId < entries[b.begin].sectionId;
+			}
+		);
+
+		orderedCases_.clear();
+		orderedCases_.reserve(entries.size());
+		for (const SectionRun& sectionRun : sectionRuns)
+			for (std::size_t i = sectionRun.begin; i < sectionRun.end; ++i)
+				orderedCases_.push_back(entries[i].testCase);
+
+		isOrdered_ = true;
+		return orderedCases_;
 	}
 
 	//////////////////////////////////////////////////
@@ -78,19 +297,24 @@ namespace winxframe
 
 	/* CONSTRUCTOR */
 
-	TestRegistry::TestRegistry()
+	TestRegistry::TestRegistry(const TestOptions& options)
 		try :
+		options_(options),
 		isCleaned_(false)
 	{
-		std::cout << "CONSTRUCTOR: TestRegistry()\n";
+		std::cout << "CONSTRUCTOR: TestRegistry(const TestOptions& options)\n";
 
-		std::filesystem::path filename = "test_log.txt";
-		TestRegistry::logFile_.open(filename);
-		if (!TestRegistry::logFile_)
+		// child processes report to their parent over a pipe and leave the log file to it
+		if (!options_.IsChildProcess())
 		{
-			std::wostringstream woss;
-			woss << L"TestRegistry::TestRegistry() : Log File could not be opened: " << filename.wstring();
-			THROW_ERROR_CTX(woss.str());
+			std::filesystem::path filename = "test_log.txt";
+			TestRegistry::logFile_.open(filename);
+			if (!TestRegistry::logFile_)
+			{
+				std::wostringstream woss;
+				woss << L"TestRegistry::TestRegistry() : Log File could not be opened: " << filename.wstring();
+				THROW_ERROR_CTX(woss.str());
+			}
 		}
 
 		std::cout.clear();
@@ -115,84 +339,468 @@ namespace winxframe
 
 	/* STATIC DEFINITIONS */
 
-	std::unique_ptr<std::unordered_map<std::string, std::unordered_map<std::string, std::vector<TestRegistry::TestCase*>>>> TestRegistry::casesPtr_ = nullptr;
-	TestRegistry::TestCase* TestRegistry::currentCasePtr_ = nullptr;
+	std::unique_ptr<TestRegistry::CaseTable> TestRegistry::casesPtr_ = nullptr;
+	thread_local TestRegistry::TestCase* TestRegistry::currentCasePtr_ = nullptr;
 	std::ofstream TestRegistry::logFile_;
 
 	/* FUNCTION DEFINITIONS */
 
-	std::unordered_map<std::string, std::unordered_map<std::string, std::vector<TestRegistry::TestCase*>>>& TestRegistry::CaseMap()
+	TestRegistry::CaseTable& TestRegistry::Cases()
 	{
 		if (!TestRegistry::casesPtr_)
-			TestRegistry::casesPtr_.reset(new std::unordered_map<std::string, std::unordered_map<std::string, std::vector<TestRegistry::TestCase*>>>);
+			TestRegistry::casesPtr_.reset(new CaseTable);
 		return *TestRegistry::casesPtr_;
 	}
 
+	const std::vector<TestRegistry::TestCase*>& TestRegistry::OrderedCases()
+	{
+		return TestRegistry::Cases().Ordered();
+	}
+
+	std::vector<TestRegistry::TestCase*> TestRegistry::SelectCases() const
+	{
+		const TestFilter groupFilter(options_.groupFilter);
+		const TestFilter sectionFilter(options_.sectionFilter);
+		const TestFilter caseFilter(options_.caseFilter);
+
+		// group and section names are shared by many cases, so each interned name is matched at most once per filter
+		enum class Match : std::uint8_t { Unknown, Accept, Reject };
+		std::vector<Match> groupMatches(TestRegistry::Cases().NameCount(), Match::Unknown);
+		std::vector<Match> sectionMatches(TestRegistry::Cases().NameCount(), Match::Unknown);
+		auto matches = [](std::vector<Match>& cache, std::uint32_t id, const TestFilter& filter, const std::string& name)
+			{
+				if (cache[id] == Match::Unknown)
+					cache[id] = filter.Matches(name) ? Match::Accept : Match::Reject;
+				return cache[id] == Match::Accept;
+			};
+
+		// benchmark, stress, and accuracy cases only run when their kind is enabled, keeping the default run to the unit tests
+		auto isKindEnabled = [this](TestCase* testCase)
+			{
+				if (dynamic_cast<BenchmarkCase*>(testCase))
+					return options_.runBenchmarks;
+				if (dynamic_cast<StressCase*>(testCase))
+					return options_.runStress;
+				if (dynamic_cast<AccuracyCase*>(testCase))
+					return options_.runAccuracy;
+				return true;
+			};
+
+		std::vector<TestCase*> selectedCases;
+		std::size_t matchIndex{};
+		for (TestCase* testCase : TestRegistry::OrderedCases())
+		{
+			if (!isKindEnabled(testCase) ||
+				!matches(groupMatches, testCase->GetGroupId(), groupFilter, testCase->GetGroupName()) ||
+				!matches(sectionMatches, testCase->GetSectionId(), sectionFilter, testCase->GetSectionName()) ||
+				!caseFilter.Matches(testCase->GetCaseName()))
+				continue;
+
+			// shards are dealt round-robin over the report order, so every process computes the same disjoint slice without coordinating
+			if (matchIndex++ % options_.shardCount == options_.shardIndex)
+				selectedCases.push_back(testCase);
+		}
+
+		return selectedCases;
+	}
+
 	TestRegistry::TestCase* TestRegistry::CurrentCase()
 	{
 		if (!TestRegistry::currentCasePtr_) throw std::runtime_error("CurrentCase: improperly invoked test case");
 		return TestRegistry::currentCasePtr_;
 	}
 
-	void TestRegistry::RunAll()
+	int TestRegistry::RunAll(const TestOptions& options)
+	{
+		TestRegistry testRegistry(options);
+		return testRegistry.Run();
+	}
+
+	void TestRegistry::RunCase(TestCase* testCase, bool isInstrumented) noexcept
+	{
+		std::chrono::time_point<std::chrono::high_resolution_clock> start, stop;
+
+		TraceScope traceScope(testCase->GetCaseName(), "case");
+		traceScope.AddArg("group", testCase->GetGroupName());
+		traceScope.AddArg("section", testCase->GetSectionName());
+
+		TestRegistry::currentCasePtr_ = testCase;
+
+		if (isInstrumented)
+		{
+			CaseMetrics caseMetrics{};
+			PerfCounters perfCounters;
+			AllocationScope allocationScope;
+			const std::chrono::nanoseconds cpuStart = metrics::ThreadCpuTime();
+			perfCounters.Start();
+			start = std::chrono::high_resolution_clock::now();
+			testCase->Run();
+			stop = std::chrono::high_resolution_clock::now();
+			caseMetrics.counters = perfCounters.Stop();
+			caseMetrics.cpuTime = metrics::ThreadCpuTime() - cpuStart;
+			caseMetrics.allocationStats = allocationScope.Stop();
+			caseMetrics.peakWorkingSet = metrics::PeakWorkingSet();
+			caseMetrics.isMeasured = true;
+			testCase->SetMetrics(caseMetrics);
+		}
+		else
+		{
+			start = std::chrono::high_resolution_clock::now();
+			testCase->Run();
+			stop = std::chrono::high_resolution_clock::now();
+		}
+		testCase->SetCaseElapsed(stop - start);
+
+		TestRegistry::currentCasePtr_ = nullptr;
+	}
+
+	void TestRegistry::RunCaseIsolated(TestCase* testCase, std::size_t caseIndex, std::chrono::milliseconds timeout, bool isInstrumented) noexcept
+	{
+		std::chrono::time_point<std::chrono::high_resolution_clock> start, stop;
+
+		// the slice covers the child process from launch to exit, on the worker thread that waited for it
+		TraceScope traceScope(testCase->GetCaseName(), "isolated case");
+		traceScope.AddArg("group", testCase->GetGroupName());
+		traceScope.AddArg("section", testCase->GetSectionName());
+
+		start = std::chrono::high_resolution_clock::now();
+		try
+		{
+			ChildProcess child(L"--test-child=" + std::to_wstring(caseIndex) + (isInstrumented ? L" --test-instrument" : L""));
+			const bool isExited = child.Wait(timeout);
+			stop = std::chrono::high_resolution_clock::now();
+			testCase->SetCaseElapsed(stop - start);
+
+			// "<checked> <passed> <elapsed ns> <metrics> <log size>\n<log>", written by RunChild() once the case has returned
+			std::istringstream iss(child.GetOutput());
+			std::uintmax_t testsChecked{}, testsPassed{};
+			long long elapsed{};
+			CaseMetrics caseMetrics{};
+			std::size_t logSize{};
+			const bool isReported = static_cast<bool>(iss >> testsChecked >> testsPassed >> elapsed) && ReadCaseMetrics(iss, caseMetrics)
+				&& static_cast<bool>(iss >> logSize) && iss.get() == '\n';
+			std::string failureLog(logSize, '\0');
+			if (isReported && logSize > 0)
+				iss.read(failureLog.data(), static_cast<std::streamsize>(logSize));
+
+			if (!isExited)
+			{
+				std::ostringstream oss;
+				oss << "timed out after " << timeout.count() << " ms, child process terminated";
+				testCase->LogCaseFail(oss.str());
+			}
+			else if (!isReported || !iss)
+			{
+				const DWORD exitCode = child.GetExitCode();
+				const std::string exitName = ChildProcess::ExitCodeName(exitCode);
+				std::ostringstream oss;
+				oss << "child process crashed with exit code 0x" << std::hex << std::uppercase << std::setw(8) << std::setfill('0') << exitCode;
+				if (!exitName.empty())
+					oss << " (" << exitName << ')';
+				testCase->LogCaseFail(oss.str());
+			}
+			else
+			{
+				testCase->SetResult(testsChecked, testsPassed, failureLog);
+				testCase->SetCaseElapsed(std::chrono::nanoseconds(elapsed));
+				testCase->SetMetrics(caseMetrics);
+			}
+		}
+		catch (const std::exception& e)
+		{
+			stop = std::chrono::high_resolution_clock::now();
+			testCase->SetCaseElapsed(stop - start);
+			testCase->LogCaseFail(e.what());
+		}
+	}
+
+	const int TestRegistry::RunChild() const noexcept
 	{
-		TestRegistry testRegistry;
-		testRegistry.Run();
+		// a crashing child must exit with its exception code instead of raising an error reporting dialog the parent would wait on
+		SetErrorMode(SEM_FAILCRITICALERRORS | SEM_NOGPFAULTERRORBOX | SEM_NOOPENFILEERRORBOX);
+		_set_abort_behavior(0, _WRITE_ABORT_MSG | _CALL_REPORTFAULT);
+		_CrtSetReportMode(_CRT_ASSERT, _CRTDBG_MODE_DEBUG);
+		_CrtSetReportMode(_CRT_ERROR, _CRTDBG_MODE_DEBUG);
+
+		const std::vector<TestCase*> testCases = TestRegistry::OrderedCases();
+		const std::size_t caseIndex = options_.childCaseIndex.value_or(testCases.size());
+		if (caseIndex >= testCases.size())
+			return EXIT_FAILURE;
+
+		TestCase* testCase = testCases[caseIndex];
+		std::chrono::time_point<std::chrono::high_resolution_clock> start, stop;
+		CaseMetrics caseMetrics{};
+		std::optional<AllocationScope> allocationScope;
+		if (options_.instrument)
+			allocationScope.emplace();
+		const std::chrono::nanoseconds cpuStart = metrics::ThreadCpuTime();
+		PerfCounters perfCounters;
+		perfCounters.Start();
+
+		TestRegistry::currentCasePtr_ = testCase;
+		start = std::chrono::high_resolution_clock::now();
+		try
+		{
+			testCase->Run();
+		}
+		catch (const std::exception& e)
+		{
+			testCase->LogCaseFail(std::string("uncaught exception: ") + e.what());
+		}
+		catch (...)
+		{
+			testCase->LogCaseFail("uncaught exception of unknown type");
+		}
+		stop = std::chrono::high_resolution_clock::now();
+		testCase->SetCaseElapsed(stop - start);
+		TestRegistry::currentCasePtr_ = nullptr;
+		if (allocationScope)
+		{
+			caseMetrics.counters = perfCounters.Stop();
+			caseMetrics.cpuTime = metrics::ThreadCpuTime() - cpuStart;
+			caseMetrics.allocationStats = allocationScope->Stop();
+			caseMetrics.peakWorkingSet = metrics::PeakWorkingSet();
+			caseMetrics.isMeasured = true;
+		}
+
+		std::ostringstream oss;
+		oss << testCase->GetTestsChecked() << ' ' << testCase->GetTestsPassed() << ' ' << testCase->GetCaseElapsed().count() << ' ';
+		WriteCaseMetrics(oss, caseMetrics);
+		oss << ' ' << testCase->GetFailureLog().size() << '\n' << testCase->GetFailureLog();
+		const std::string report = oss.str();
+
+		HANDLE pipe = reinterpret_cast<HANDLE>(options_.childPipe);
+		std::size_t offset{};
+		while (offset < report.size())
+		{
+			DWORD bytesWritten{};
+			const DWORD bytesToWrite = static_cast<DWORD>(std::min<std::size_t>(report.size() - offset, 1 << 16));
+			if (!WriteFile(pipe, report.data() + offset, bytesToWrite, &bytesWritten, nullptr))
+				return EXIT_FAILURE;
+			offset += bytesWritten;
+		}
+		CloseHandle(pipe);
+
+		return EXIT_SUCCESS;
 	}
 
 	const int TestRegistry::Run() const noexcept
 	{
-		std::uintmax_t testsTotal{}, casesTotal{};
+		if (options_.IsChildProcess())
+			return this->RunChild();
+
+		std::uintmax_t testsTotal{};
 		std::streamsize numMaxGroupName{ 11 }, numMaxSectionName{ 13 }, numMaxCaseName{ 10 }, numMaxTests{ 11 }, numMaxPercent{ 6 }, 
 			numMaxWeight{ 3 }, numMaxStatus{ 4 }, numMaxTime{ 8 };
 		std::chrono::time_point<std::chrono::high_resolution_clock> start, stop;
 
-		for (auto& [groupName, sectionMap] : TestRegistry::CaseMap())
+		std::vector<TestCase*> testCases;
+		try
+		{
+			testCases = this->SelectCases();
+		}
+		catch (const std::exception& e)
 		{
-			for (auto& [sectionName, testCases] : sectionMap)
+			std::cerr << "TestRegistry::Run() : " << e.what() << '\n';
+			if (TestRegistry::logFile_.is_open())
+				TestRegistry::logFile_ << "TestRegistry::Run() : " << e.what() << '\n';
+			return EXIT_FAILURE;
+		}
+
+		const std::size_t casesRegistered = TestRegistry::Cases().Size();
+		if (testCases.size() != casesRegistered)
+		{
+			std::ostringstream oss;
+			oss << "Running " << testCases.size() << " of " << casesRegistered << " registered test cases";
+			if (options_.shardCount > 1)
+				oss << " (shard " << options_.shardIndex << '/' << options_.shardCount << ')';
+			oss << '\n';
+			std::cout << oss.str();
+			if (TestRegistry::logFile_.is_open())
+				TestRegistry::logFile_ << oss.str();
+		}
+
+		// benchmark, stress, and accuracy cases are held back and run one at a time once the unit tests are done, so they never compete for a core
+		std::vector<TestCase*> unitCases;
+		std::vector<BenchmarkCase*> benchmarkCases;
+		std::vector<StressCase*> stressCases;
+		std::vector<AccuracyCase*> accuracyCases;
+		unitCases.reserve(testCases.size());
+		for (TestCase* testCase : testCases)
+		{
+			if (BenchmarkCase* benchmarkCase = dynamic_cast<BenchmarkCase*>(testCase))
+				benchmarkCases.push_back(benchmarkCase);
+			else if (StressCase* stressCase = dynamic_cast<StressCase*>(testCase))
+				stressCases.push_back(stressCase);
+			else if (AccuracyCase* accuracyCase = dynamic_cast<AccuracyCase*>(testCase))
+				accuracyCases.push_back(accuracyCase);
+			else
+				unitCases.push_back(testCase);
+		}
+
+		// isolated cases are identified to their child process by their index in the unfiltered report order, which every process agrees on
+		std::unordered_map<const TestCase*, std::size_t> caseIndices;
+		if (options_.isolated)
+		{
+			const std::vector<TestCase*> orderedCases = TestRegistry::OrderedCases();
+			for (std::size_t i = 0; i < orderedCases.size(); ++i)
+				caseIndices.emplace(orderedCases[i], i);
+		}
+
+		std::unique_ptr<TraceWriter> trace;
+		if (!options_.tracePath.empty())
+		{
+			trace = std::make_unique<TraceWriter>(options_.tracePath);
+			if (!trace->IsOpen())
 			{
-				for (TestCase* testCase : testCases)
-				{
-					TestRegistry::currentCasePtr_ = testCase;
+				std::ostringstream oss;
+				oss << "TestRegistry::Run() : Trace file could not be opened: " << options_.tracePath.string() << '\n';
+				std::cout << oss.str();
+				if (TestRegistry::logFile_.is_open())
+					TestRegistry::logFile_ << oss.str();
+				trace.reset();
+			}
+		}
 
-					start = std::chrono::high_resolution_clock::now();
-					testCase->Run();
-					testsTotal = std::max(testsTotal, testCase->GetTestsChecked());
-					stop = std::chrono::high_resolution_clock::now();
-					testCase->SetCaseElapsed(stop - start);
+		// execution order only, the reports keep the registry order
+		TestHistory history;
+		std::vector<TestCase*> scheduledCases = unitCases;
+		if (!options_.historyPath.empty() && history.Load(options_.historyPath))
+			history.Schedule(scheduledCases);
 
-					casesTotal += 1;
-					numMaxGroupName = stream_utils::MaxStreamSize(testCase->GetGroupName().size(), numMaxGroupName);
-					numMaxSectionName = stream_utils::MaxStreamSize(testCase->GetSectionName().size(), numMaxSectionName);
-					numMaxCaseName = stream_utils::MaxStreamSize(testCase->GetCaseName().size(), numMaxCaseName);
-					numMaxWeight = stream_utils::MaxStreamSize(testCase->GetCaseWeight(), numMaxWeight);
+		// with fail-fast, cases not yet started when a case fails are skipped; each flag is only written by the worker that ran its case
+		std::atomic<bool> isStopped{ false };
+		std::vector<std::uint8_t> isRun(scheduledCases.size(), 0);
+		auto runUnitCase = [this, &caseIndices, &isStopped, &isRun](TestCase* testCase, std::size_t scheduleIndex)
+			{
+				if (isStopped.load(std::memory_order_relaxed))
+					return;
+				if (options_.isolated)
+					TestRegistry::RunCaseIsolated(testCase, caseIndices.at(testCase), options_.caseTimeout, options_.instrument);
+				else
+					TestRegistry::RunCase(testCase, options_.instrument);
+				isRun[scheduleIndex] = 1;
+				if (options_.failFast && IsCaseFailed(testCase))
+					isStopped.store(true, std::memory_order_relaxed);
+			};
 
-					TestRegistry::currentCasePtr_ = nullptr;
-				}
+		start = std::chrono::high_resolution_clock::now();
+		if (options_.parallel && scheduledCases.size() > 1)
+		{
+			WorkStealingPool pool(options_.jobs);
+			for (std::size_t i = 0; i < scheduledCases.size(); ++i)
+				pool.Submit([&runUnitCase, &scheduledCases, i] { runUnitCase(scheduledCases[i], i); });
+			pool.Wait();
+		}
+		else
+		{
+			for (std::size_t i = 0; i < scheduledCases.size(); ++i)
+				runUnitCase(scheduledCases[i], i);
+		}
+		std::size_t stressCasesRun = 0;
+		for (; stressCasesRun < stressCases.size() && !isStopped; ++stressCasesRun)
+		{
+			TestRegistry::RunCase(stressCases[stressCasesRun]);
+			if (options_.failFast && IsCaseFailed(stressCases[stressCasesRun]))
+				isStopped = true;
+		}
+		std::size_t accuracyCasesRun = 0;
+		for (; accuracyCasesRun < accuracyCases.size() && !isStopped; ++accuracyCasesRun)
+		{
+			accuracyCases[accuracyCasesRun]->SetSampleCount(options_.accuracySamples);
+			TestRegistry::RunCase(accuracyCases[accuracyCasesRun]);
+			if (options_.failFast && IsCaseFailed(accuracyCases[accuracyCasesRun]))
+				isStopped = true;
+		}
+		if (!isStopped)
+		{
+			for (BenchmarkCase* benchmarkCase : benchmarkCases)
+			{
+				benchmarkCase->SetTimeBudget(options_.benchmarkWarmup, options_.benchmarkTime);
+				TestRegistry::RunCase(benchmarkCase);
+			}
+		}
+		stop = std::chrono::high_resolution_clock::now();
+		trace.reset();
+
+		if (isStopped)
+		{
+			// cases that never ran are left out of the history and the reports
+			std::unordered_set<const TestCase*> skippedCases;
+			for (std::size_t i = 0; i < scheduledCases.size(); ++i)
+				if (!isRun[i])
+					skippedCases.insert(scheduledCases[i]);
+			skippedCases.insert(stressCases.begin() + stressCasesRun, stressCases.end());
+			skippedCases.insert(accuracyCases.begin() + accuracyCasesRun, accuracyCases.end());
+			skippedCases.insert(benchmarkCases.begin(), benchmarkCases.end());
+			std::erase_if(testCases, [&skippedCases](const TestCase* testCase) { return skippedCases.contains(testCase); });
+			std::erase_if(unitCases, [&skippedCases](const TestCase* testCase) { return skippedCases.contains(testCase); });
+			stressCases.resize(stressCasesRun);
+			accuracyCases.resize(accuracyCasesRun);
+			benchmarkCases.clear();
+
+			std::ostringstream oss;
+			oss << "Fail-fast: stopped after the first failure, " << skippedCases.size() << " case(s) not run\n";
+			std::cout << oss.str();
+			if (TestRegistry::logFile_.is_open())
+				TestRegistry::logFile_ << oss.str();
+		}
+
+		if (!options_.historyPath.empty())
+			this->UpdateHistory(history, testCases);
+
+		if (!benchmarkCases.empty() && !options_.baselinePath.empty())
+			this->CompareBaseline(benchmarkCases);
+
+		bool isFailed = false;
+		for (TestCase* testCase : testCases)
+		{
+			if (!testCase->GetFailureLog().empty())
+			{
+				std::cout << testCase->GetFailureLog();
+				if (TestRegistry::logFile_.is_open())
+					TestRegistry::logFile_ << testCase->GetFailureLog();
 			}
+
+			testsTotal = std::max(testsTotal, testCase->GetTestsChecked());
+			numMaxGroupName = stream_utils::MaxStreamSize(testCase->GetGroupName().size(), numMaxGroupName);
+			numMaxSectionName = stream_utils::MaxStreamSize(testCase->GetSectionName().size(), numMaxSectionName);
+			numMaxCaseName = stream_utils::MaxStreamSize(testCase->GetCaseName().size(), numMaxCaseName);
+			numMaxWeight = stream_utils::MaxStreamSize(testCase->GetCaseWeight(), numMaxWeight);
+			isFailed |= IsCaseFailed(testCase);
 		}
+		for (const BenchmarkCase* benchmarkCase : benchmarkCases)
+			isFailed |= benchmarkCase->IsRegressed();
 		numMaxTests = testsTotal == 0 ? numMaxTests : static_cast<std::streamsize>(floor(log10(testsTotal))) + 1;
-		this->ReportSummary(casesTotal, numMaxGroupName, numMaxSectionName, numMaxCaseName, numMaxTests, numMaxPercent, numMaxWeight, numMaxStatus, numMaxTime);
+		this->ReportSummary(testCases, stop - start, numMaxGroupName, numMaxSectionName, numMaxCaseName, numMaxTests, numMaxPercent, numMaxWeight, numMaxStatus, numMaxTime);
+		if (options_.instrument && !unitCases.empty())
+			this->ReportMetrics(unitCases);
+		if (!stressCases.empty())
+			this->ReportStress(stressCases);
+		if (!accuracyCases.empty())
+			this->ReportAccuracy(accuracyCases);
+		if (!benchmarkCases.empty())
+			this->ReportBenchmarks(benchmarkCases);
 
-		return EXIT_SUCCESS;
+		return isFailed ? EXIT_FAILURE : EXIT_SUCCESS;
 	}
 
-	const void TestRegistry::ReportSummary(std::uintmax_t casesTotal, std::streamsize numMaxGroupName, std::streamsize numMaxSectionName,
-		std::streamsize numMaxCaseName, std::streamsize numMaxTests, std::streamsize numMaxPercent, std::streamsize numMaxWeight, 
-		std::streamsize numMaxStatus, std::streamsize numMaxTime) const noexcept
+	const void TestRegistry::ReportSummary(const std::vector<TestCase*>& testCases, std::chrono::nanoseconds wallElapsed, std::streamsize numMaxGroupName,
+		std::streamsize numMaxSectionName, std::streamsize numMaxCaseName, std::streamsize numMaxTests, std::streamsize numMaxPercent,
+		std::streamsize numMaxWeight, std::streamsize numMaxStatus, std::streamsize numMaxTime) const noexcept
 	{
-		std::ostringstream oss;
+		std::uintmax_t casesTotal = testCases.size();
 
 		std::streamsize tableWidth = numMaxGroupName + numMaxSectionName + numMaxCaseName + ((numMaxTests * 2) + 1) + numMaxPercent + ((numMaxWeight * 2) + 1) + numMaxStatus + numMaxTime + 25;
 		std::streamsize titleWidth = tableWidth - 4;
 		std::uintmax_t rowsTotal = casesTotal + 6;
-		std::uintmax_t casesPassed{}, testsChecked{}, testsPassed{};
+		std::uintmax_t casesPassed{}, casesRegressed{}, testsChecked{}, testsPassed{};
 		double score{}, maxScore{};
 		std::chrono::nanoseconds casesTotalElapsed{};
 
-		oss.str().reserve(tableWidth * rowsTotal);
-
-		oss << console_color::BrightWhite
+		// rows are written once, with their colors as escape sequences, instead of flushing each colored cell to the console
+		ReportBuffer report(static_cast<std::size_t>((tableWidth + 32) * rowsTotal) + 512);
+		report << console_color::BrightWhite
 			<< std::left
 			<< std::string(tableWidth, '=') << '\n'
 			<< "| " << string_utils::CenterText("UNIT TESTS REPORT", static_cast<int>(titleWidth)) << " |" << '\n'
@@ -206,101 +814,549 @@ namespace winxframe
 			<< " | " << std::setw(numMaxStatus) << "STAT"
 			<< " | " << std::setw(numMaxTime) << "TIME"
 			<< " |" << '\n' << std::string(tableWidth, '-') << '\n';
-		std::cout << oss.str();
-		oss.str("");
-		oss.clear();
 
-		for (const auto& groupName : container_utils::SortedMapKeys(CaseMap()))
+		for (auto* testCase : testCases)
 		{
-			const auto& sectionMap = CaseMap().at(groupName);
+			bool passed = testCase->GetTestsPassed() == testCase->GetTestsChecked() && testCase->GetTestsChecked() > 0;
+			const BenchmarkCase* benchmarkCase = dynamic_cast<const BenchmarkCase*>(testCase);
+			bool regressed = benchmarkCase && benchmarkCase->IsRegressed();
+			double ratio = double(testCase->GetTestsPassed()) / std::max<std::uintmax_t>(1, testCase->GetTestsChecked());
+			double percentage = ratio * 100.0;
+			casesTotalElapsed += testCase->GetCaseElapsed();
+			time_utils::double_time caseElapsed = time_utils::ConvertToDouble(testCase->GetCaseElapsed());
+
+			std::ostringstream strPercentage;
+			strPercentage << std::setprecision(1) << std::fixed << percentage << '%';
+			std::ostringstream strCaseElapsed;
+			strCaseElapsed << std::setprecision(1) << std::fixed << caseElapsed.time << ' ' << caseElapsed.unit;
+
+			report << "| " << std::setw(numMaxGroupName) << (testCase->GetGroupName().empty() ? "ungrouped" : testCase->GetGroupName())
+				<< " | " << std::setw(numMaxSectionName) << (testCase->GetSectionName().empty() ? "default" : testCase->GetSectionName())
+				<< " | " << std::setw(numMaxCaseName) << testCase->GetCaseName()
+				<< " | " << std::setw(numMaxTests) << testCase->GetTestsPassed() << '/' << std::setw(numMaxTests) << testCase->GetTestsChecked()
+				<< " | " << std::setw(numMaxPercent) << strPercentage.str()
+				<< " | " << std::setw(numMaxWeight) << std::setprecision(1) << std::fixed << (ratio * testCase->GetCaseWeight()) << '/' << std::setw(numMaxWeight) << testCase->GetCaseWeight()
+				<< " | "
+				<< (passed && !regressed ? console_color::WhiteOnGreen : console_color::WhiteOnRed) << std::setw(numMaxStatus) << (!passed ? "FAIL" : regressed ? "SLOW" : "PASS")
+				<< console_color::BrightWhite << " | " << std::setw(numMaxTime) << strCaseElapsed.str() << " |" << '\n';
 
-			// collect section names
-			std::vector<std::string> sectionKeys;
-			sectionKeys.reserve(sectionMap.size());
-			for (const auto& [sectionName, _] : sectionMap)
-				sectionKeys.push_back(sectionName);
+			TestRegistry::logFile_ << std::setw(5) << std::setprecision(1) << std::fixed << ratio * testCase->GetCaseWeight()
+				<< '\t' << testCase->GetCaseWeight()
+				<< '\t' << testCase->GetGroupName()
+				<< '\t' << testCase->GetSectionName()
+				<< '\t' << testCase->GetCaseName()
+				<< '\n';
+
+			casesPassed += passed;
+			casesRegressed += regressed;
+			testsChecked += testCase->GetTestsChecked();
+			testsPassed += testCase->GetTestsPassed();
+			score += ratio * testCase->GetCaseWeight();
+			maxScore += testCase->GetCaseWeight();
+		}
+		report << std::string(tableWidth, '-') << '\n';
+
+		time_utils::double_time totalElapsed = time_utils::ConvertToDouble(casesTotalElapsed);
+		double checkPercentage{ 100.0 * testsPassed / std::max<std::uintmax_t>(1, testsChecked) };
+
+		std::ostringstream oss;
+		oss << '\n' << "Total Running Time: " << std::setprecision(2) << std::fixed << totalElapsed.time << ' ' << totalElapsed.unit;
+		if (options_.parallel)
+		{
+			time_utils::double_time wallTime = time_utils::ConvertToDouble(wallElapsed);
+			oss << '\n' << "Wall Clock Time: " << std::setprecision(2) << std::fixed << wallTime.time << ' ' << wallTime.unit;
+		}
+		oss << '\n' << std::setprecision(1) << std::fixed << testsPassed << '/' << testsChecked << " tests (" << checkPercentage << "%)\n"
+			<< casesPassed << '/' << casesTotal << " cases (" << std::setprecision(1) << std::fixed << (casesTotal ? 100.0 * casesPassed / casesTotal : 0.0) << "%)\n"
+			<< score << " of " << maxScore << " score (" << std::setprecision(1) << std::fixed << (maxScore > 0.0 ? score * 100 / maxScore : 0.0) << "%)\n";
+		if (casesRegressed > 0)
+			oss << casesRegressed << " benchmark regression(s) against " << options_.baselinePath.string() << '\n';
+		report << oss.str() << '\n' << console_color::Default;
+		report.Flush();
+		TestRegistry::logFile_ << oss.str() << std::endl;
+	}
 
-			// sort sections by the CaseName of the first test case in each section
-			std::sort(sectionKeys.begin(), sectionKeys.end(),
-				[&](const std::string& a, const std::string& b)
+	const void TestRegistry::ReportMetrics(const std::vector<TestCase*>& testCases) const noexcept
+	{
+		std::streamsize numMaxGroupName{ 10 }, numMaxSectionName{ 12 }, numMaxCaseName{ 9 }, numMaxCount{ 6 }, numMaxBytes{ 9 }, numMaxTime{ 9 }, numMaxPercent{ 8 },
+			numMaxCounter{ 8 }, numMaxIPC{ 4 };
+		auto formatBytes = [](std::uint64_t bytes)
+			{
+				constexpr const char* units[] = { "B", "KiB", "MiB", "GiB", "TiB" };
+				double value = static_cast<double>(bytes);
+				std::size_t unit = 0;
+				while (value >= 1024.0 && unit + 1 < std::size(units))
 				{
-					const auto& vecA = sectionMap.at(a);
-					const auto& vecB = sectionMap.at(b);
-					return vecA.front()->GetCaseName() < vecB.front()->GetCaseName();
+					value /= 1024.0;
+					++unit;
 				}
-			);
+				std::ostringstream strBytes;
+				strBytes << std::setprecision(unit == 0 ? 0 : 1) << std::fixed << value << ' ' << units[unit];
+				return strBytes.str();
+			};
+		auto formatTime = [](std::chrono::nanoseconds nanoseconds)
+			{
+				time_utils::double_time time = time_utils::ConvertToDouble(nanoseconds);
+				std::ostringstream strTime;
+				strTime << std::setprecision(1) << std::fixed << time.time << ' ' << time.unit;
+				return strTime.str();
+			};
+		auto formatPercent = [](std::chrono::nanoseconds cpuTime, std::chrono::nanoseconds wallTime)
+			{
+				std::ostringstream strPercent;
+				strPercent << std::setprecision(1) << std::fixed << (wallTime.count() > 0 ? 100.0 * cpuTime.count() / wallTime.count() : 0.0) << '%';
+				return strPercent.str();
+			};
+
+		std::uint64_t peakWorkingSet{};
+		for (const TestCase* testCase : testCases)
+		{
+			const CaseMetrics& caseMetrics = testCase->GetMetrics();
+			numMaxGroupName = stream_utils::MaxStreamSize(testCase->GetGroupName().size(), numMaxGroupName);
+			numMaxSectionName = stream_utils::MaxStreamSize(testCase->GetSectionName().size(), numMaxSectionName);
+			numMaxCaseName = stream_utils::MaxStreamSize(testCase->GetCaseName().size(), numMaxCaseName);
+			numMaxCount = stream_utils::MaxStreamSize(std::to_string(caseMetrics.allocationStats.allocations).size(), numMaxCount);
+			numMaxBytes = stream_utils::MaxStreamSize(formatBytes(caseMetrics.allocationStats.bytesAllocated).size(), numMaxBytes);
+			numMaxBytes = stream_utils::MaxStreamSize(formatBytes(caseMetrics.peakWorkingSet).size(), numMaxBytes);
+			numMaxCounter = stream_utils::MaxStreamSize(FormatCounter(caseMetrics.counters.cycles).size(), numMaxCounter);
+			peakWorkingSet = std::max(peakWorkingSet, caseMetrics.peakWorkingSet);
+		}
+
+		std::streamsize tableWidth = numMaxGroupName + numMaxSectionName + numMaxCaseName + (numMaxCount * 2) + (numMaxBytes * 3) + (numMaxTime * 2) + numMaxPercent +
+			(numMaxCounter * 4) + numMaxIPC + 49;
+		std::streamsize titleWidth = tableWidth - 4;
+
+		ReportBuffer report(static_cast<std::size_t>((tableWidth + 1) * (testCases.size() + 8)) + 64);
+		report << console_color::BrightWhite
+			<< std::left
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << string_utils::CenterText("RESOURCE REPORT", static_cast<int>(titleWidth)) << " |" << '\n'
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << std::setw(numMaxGroupName) << "GROUP NAME"
+			<< " | " << std::setw(numMaxSectionName) << "SECTION NAME"
+			<< " | " << std::setw(numMaxCaseName) << "CASE NAME"
+			<< " | " << std::setw(numMaxCount) << "ALLOCS"
+			<< " | " << std::setw(numMaxCount) << "FREES"
+			<< " | " << std::setw(numMaxBytes) << "BYTES"
+			<< " | " << std::setw(numMaxBytes) << "PEAK HEAP"
+			<< " | " << std::setw(numMaxTime) << "CPU TIME"
+			<< " | " << std::setw(numMaxTime) << "WALL TIME"
+			<< " | " << std::setw(numMaxPercent) << "CPU/WALL"
+			<< " | " << std::setw(numMaxBytes) << "PEAK RSS"
+			<< " | " << std::setw(numMaxCounter) << "CYCLES"
+			<< " | " << std::setw(numMaxIPC) << "IPC"
+			<< " | " << std::setw(numMaxCounter) << "BR-MISS"
+			<< " | " << std::setw(numMaxCounter) << "L1D-MISS"
+			<< " | " << std::setw(numMaxCounter) << "LLC-MISS"
+			<< " |" << '\n' << std::string(tableWidth, '-') << '\n';
+
+		for (const TestCase* testCase : testCases)
+		{
+			const CaseMetrics& caseMetrics = testCase->GetMetrics();
+			const AllocationStats& allocationStats = caseMetrics.allocationStats;
+
+			report << "| " << std::setw(numMaxGroupName) << (testCase->GetGroupName().empty() ? "ungrouped" : testCase->GetGroupName())
+				<< " | " << std::setw(numMaxSectionName) << (testCase->GetSectionName().empty() ? "default" : testCase->GetSectionName())
+				<< " | " << std::setw(numMaxCaseName) << testCase->GetCaseName();
+			if (!caseMetrics.isMeasured)
+			{
+				// a crashed or timed out isolated case never reported its metrics
+				report << " | " << std::setw(tableWidth - numMaxGroupName - numMaxSectionName - numMaxCaseName - 13) << "not measured" << " |" << '\n';
+				continue;
+			}
+			report << " | " << std::setw(numMaxCount) << allocationStats.allocations
+				<< " | " << std::setw(numMaxCount) << allocationStats.deallocations
+				<< " | " << std::setw(numMaxBytes) << formatBytes(allocationStats.bytesAllocated)
+				<< " | " << std::setw(numMaxBytes) << formatBytes(allocationStats.peakLiveBytes)
+				<< " | " << std::setw(numMaxTime) << formatTime(caseMetrics.cpuTime)
+				<< " | " << std::setw(numMaxTime) << formatTime(testCase->GetCaseElapsed())
+				<< " | " << std::setw(numMaxPercent) << formatPercent(caseMetrics.cpuTime, testCase->GetCaseElapsed())
+				<< " | " << std::setw(numMaxBytes) << formatBytes(caseMetrics.peakWorkingSet)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(caseMetrics.counters.cycles)
+				<< " | " << std::setw(numMaxIPC) << FormatIPC(caseMetrics.counters)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(caseMetrics.counters.branchMisses)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(caseMetrics.counters.l1dMisses)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(caseMetrics.counters.llcMisses)
+				<< " |" << '\n';
+
+			TestRegistry::logFile_ << allocationStats.allocations
+				<< '\t' << allocationStats.deallocations
+				<< '\t' << allocationStats.bytesAllocated
+				<< '\t' << allocationStats.peakLiveBytes
+				<< '\t' << caseMetrics.cpuTime.count()
+				<< '\t' << testCase->GetCaseElapsed().count()
+				<< '\t' << caseMetrics.peakWorkingSet
+				<< '\t' << FormatCounter(caseMetrics.counters.cycles)
+				<< '\t' << FormatCounter(caseMetrics.counters.instructions)
+				<< '\t' << FormatCounter(caseMetrics.counters.branchMisses)
+				<< '\t' << FormatCounter(caseMetrics.counters.l1dMisses)
+				<< '\t' << FormatCounter(caseMetrics.counters.llcMisses)
+				<< '\t' << testCase->GetGroupName()
+				<< '\t' << testCase->GetSectionName()
+				<< '\t' << testCase->GetCaseName()
+				<< '\n';
+		}
+		report << std::string(tableWidth, '-') << '\n'
+			<< "Peak Working Set: " << formatBytes(peakWorkingSet) << '\n'
+			<< '\n' << console_color::Default;
+		report.Flush();
+		TestRegistry::logFile_ << std::endl;
+	}
 
-			for (const auto& sectionName : sectionKeys)
+	const void TestRegistry::ReportBenchmarks(const std::vector<BenchmarkCase*>& benchmarkCases) const noexcept
+	{
+		std::streamsize numMaxGroupName{ 10 }, numMaxSectionName{ 12 }, numMaxCaseName{ 9 }, numMaxIterations{ 10 }, numMaxTime{ 9 }, numMaxBaseline{ 12 },
+			numMaxCounter{ 11 }, numMaxIPC{ 4 };
+		auto formatIterations = [](const BenchmarkStats& stats)
 			{
-				const auto& testCases = sectionMap.at(sectionName);
+				std::ostringstream strIterations;
+				strIterations << stats.samples << 'x' << stats.iterations;
+				return strIterations.str();
+			};
+		auto formatBaseline = [](const BaselineComparison& comparison)
+			{
+				if (!comparison.hasBaseline)
+					return std::string("new");
+				std::ostringstream strBaseline;
+				strBaseline << std::showpos << std::setprecision(1) << std::fixed << comparison.change * 100.0 << '%' << std::noshowpos << (comparison.isRegressed ? " SLOW" : "");
+				return strBaseline.str();
+			};
+		auto formatTime = [](double nanoseconds)
+			{
+				time_utils::double_time time = time_utils::ConvertToDouble(std::chrono::duration<double, std::nano>(nanoseconds));
+				std::ostringstream strTime;
+				strTime << std::setprecision(1) << std::fixed << time.time << ' ' << time.unit;
+				return strTime.str();
+			};
+
+		for (const BenchmarkCase* benchmarkCase : benchmarkCases)
+		{
+			numMaxGroupName = stream_utils::MaxStreamSize(benchmarkCase->GetGroupName().size(), numMaxGroupName);
+			numMaxSectionName = stream_utils::MaxStreamSize(benchmarkCase->GetSectionName().size(), numMaxSectionName);
+			numMaxCaseName = stream_utils::MaxStreamSize(benchmarkCase->GetCaseName().size(), numMaxCaseName);
+			numMaxIterations = stream_utils::MaxStreamSize(formatIterations(benchmarkCase->GetStats()).size(), numMaxIterations);
+		}
+
+		std::streamsize tableWidth = numMaxGroupName + numMaxSectionName + numMaxCaseName + numMaxIterations + (numMaxTime * 5) + numMaxBaseline +
+			(numMaxCounter * 4) + numMaxIPC + 46;
+		std::streamsize titleWidth = tableWidth - 4;
+
+		ReportBuffer report(static_cast<std::size_t>((tableWidth + 1) * (benchmarkCases.size() + 7)) + 32);
+		report << console_color::BrightWhite
+			<< std::left
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << string_utils::CenterText("BENCHMARK REPORT (TIME PER ITERATION)", static_cast<int>(titleWidth)) << " |" << '\n'
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << std::setw(numMaxGroupName) << "GROUP NAME"
+			<< " | " << std::setw(numMaxSectionName) << "SECTION NAME"
+			<< " | " << std::setw(numMaxCaseName) << "CASE NAME"
+			<< " | " << std::setw(numMaxIterations) << "ITERATIONS"
+			<< " | " << std::setw(numMaxTime) << "MEDIAN"
+			<< " | " << std::setw(numMaxTime) << "MAD"
+			<< " | " << std::setw(numMaxTime) << "MIN"
+			<< " | " << std::setw(numMaxTime) << "P90"
+			<< " | " << std::setw(numMaxTime) << "P99"
+			<< " | " << std::setw(numMaxBaseline) << "VS BASELINE"
+			<< " | " << std::setw(numMaxCounter) << "CYCLES/IT"
+			<< " | " << std::setw(numMaxIPC) << "IPC"
+			<< " | " << std::setw(numMaxCounter) << "BR-MISS/IT"
+			<< " | " << std::setw(numMaxCounter) << "L1D-MISS/IT"
+			<< " | " << std::setw(numMaxCounter) << "LLC-MISS/IT"
+			<< " |" << '\n' << std::string(tableWidth, '-') << '\n';
 
-				for (auto* testCase : testCases)
+		for (const BenchmarkCase* benchmarkCase : benchmarkCases)
+		{
+			const BenchmarkStats& stats = benchmarkCase->GetStats();
+			const double totalIterations = static_cast<double>(std::max<std::uint64_t>(1, stats.samples * stats.iterations));
+
+			report << "| " << std::setw(numMaxGroupName) << (benchmarkCase->GetGroupName().empty() ? "ungrouped" : benchmarkCase->GetGroupName())
+				<< " | " << std::setw(numMaxSectionName) << (benchmarkCase->GetSectionName().empty() ? "default" : benchmarkCase->GetSectionName())
+				<< " | " << std::setw(numMaxCaseName) << benchmarkCase->GetCaseName()
+				<< " | " << std::setw(numMaxIterations) << formatIterations(stats)
+				<< " | " << std::setw(numMaxTime) << formatTime(stats.median)
+				<< " | " << std::setw(numMaxTime) << formatTime(stats.mad)
+				<< " | " << std::setw(numMaxTime) << formatTime(stats.min)
+				<< " | " << std::setw(numMaxTime) << formatTime(stats.p90)
+				<< " | " << std::setw(numMaxTime) << formatTime(stats.p99)
+				<< " | " << std::setw(numMaxBaseline) << formatBaseline(benchmarkCase->GetComparison())
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(stats.counters.cycles, totalIterations)
+				<< " | " << std::setw(numMaxIPC) << FormatIPC(stats.counters)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(stats.counters.branchMisses, totalIterations)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(stats.counters.l1dMisses, totalIterations)
+				<< " | " << std::setw(numMaxCounter) << FormatCounter(stats.counters.llcMisses, totalIterations)
+				<< " |" << '\n';
+
+			TestRegistry::logFile_ << std::setprecision(3) << std::fixed << stats.median
+				<< '\t' << stats.mad
+				<< '\t' << stats.min
+				<< '\t' << stats.p90
+				<< '\t' << stats.p99
+				<< '\t' << benchmarkCase->GetGroupName()
+				<< '\t' << benchmarkCase->GetSectionName()
+				<< '\t' << benchmarkCase->GetCaseName()
+				<< '\n';
+		}
+		report << std::string(tableWidth, '-') << '\n'
+			<< '\n' << console_color::Default;
+		report.Flush();
+		TestRegistry::logFile_ << std::endl;
+	}
+
+	const void TestRegistry::ReportStress(const std::vector<StressCase*>& stressCases) const noexcept
+	{
+		std::streamsize numMaxGroupName{ 10 }, numMaxSectionName{ 12 }, numMaxCaseName{ 9 }, numMaxThreads{ 7 }, numMaxOperations{ 10 }, numMaxTime{ 9 },
+			numMaxRate{ 12 }, numMaxScaling{ 7 };
+		auto formatTime = [](std::chrono::nanoseconds nanoseconds)
+			{
+				time_utils::double_time time = time_utils::ConvertToDouble(nanoseconds);
+				std::ostringstream strTime;
+				strTime << std::setprecision(1) << std::fixed << time.time << ' ' << time.unit;
+				return strTime.str();
+			};
+		auto formatRate = [](double opsPerSecond)
+			{
+				constexpr const char* units[] = { "", " k", " M", " G" };
+				std::size_t unit = 0;
+				while (opsPerSecond >= 1000.0 && unit + 1 < std::size(units))
 				{
-					bool passed = testCase->GetTestsPassed() == testCase->GetTestsChecked() && testCase->GetTestsChecked() > 0;
-					double ratio = double(testCase->GetTestsPassed()) / std::max<std::uintmax_t>(1, testCase->GetTestsChecked());
-					double percentage = ratio * 100.0;
-					casesTotalElapsed += testCase->GetCaseElapsed();
-					time_utils::double_time caseElapsed = time_utils::ConvertToDouble(testCase->GetCaseElapsed());
-
-					std::ostringstream strPercentage;
-					strPercentage << std::setprecision(1) << std::fixed << percentage << '%';
-					std::ostringstream strCaseElapsed;
-					strCaseElapsed << std::setprecision(1) << std::fixed << caseElapsed.time << ' ' << caseElapsed.unit;
-
-					oss << console_color::BrightWhite
-						<< "| " << std::setw(numMaxGroupName) << (groupName.empty() ? "ungrouped" : groupName)
-						<< " | " << std::setw(numMaxSectionName) << (sectionName.empty() ? "default" : sectionName)
-						<< " | " << std::setw(numMaxCaseName) << testCase->GetCaseName()
-						<< " | " << std::setw(numMaxTests) << testCase->GetTestsPassed() << '/' << std::setw(numMaxTests) << testCase->GetTestsChecked()
-						<< " | " << std::setw(numMaxPercent) << strPercentage.str()
-						<< " | " << std::setw(numMaxWeight) << std::setprecision(1) << std::fixed << (ratio * testCase->GetCaseWeight()) << '/' << std::setw(numMaxWeight) << testCase->GetCaseWeight()
-						<< " | ";
-					std::cout << oss.str();
-					oss.str("");
-					oss.clear();
-
-					oss << (passed ? console_color::WhiteOnGreen : console_color::WhiteOnRed) << std::setw(numMaxStatus) << (passed ? "PASS" : "FAIL");
-					std::cout << oss.str();
-					oss.str("");
-					oss.clear();
-
-					oss << console_color::BrightWhite << " | " << std::setw(numMaxTime) << strCaseElapsed.str() << " |" << "\n";
-					std::cout << oss.str();
-					oss.str("");
-					oss.clear();
-
-					TestRegistry::logFile_ << std::setw(5) << std::setprecision(1) << std::fixed << ratio * testCase->GetCaseWeight()
-						<< '\t' << testCase->GetCaseWeight()
-						<< '\t' << testCase->GetGroupName()
-						<< '\t' << testCase->GetSectionName()
-						<< '\t' << testCase->GetCaseName()
-						<< '\n';
-
-					casesPassed += passed;
-					testsChecked += testCase->GetTestsChecked();
-					testsPassed += testCase->GetTestsPassed();
-					score += ratio * testCase->GetCaseWeight();
-					maxScore += testCase->GetCaseWeight();
+					opsPerSecond /= 1000.0;
+					++unit;
 				}
+				std::ostringstream strRate;
+				strRate << std::setprecision(unit == 0 ? 0 : 2) << std::fixed << opsPerSecond << units[unit];
+				return strRate.str();
+			};
+
+		std::size_t rowsTotal = 0;
+		for (const StressCase* stressCase : stressCases)
+		{
+			numMaxGroupName = stream_utils::MaxStreamSize(stressCase->GetGroupName().size(), numMaxGroupName);
+			numMaxSectionName = stream_utils::MaxStreamSize(stressCase->GetSectionName().size(), numMaxSectionName);
+			numMaxCaseName = stream_utils::MaxStreamSize(stressCase->GetCaseName().size(), numMaxCaseName);
+			rowsTotal += stressCase->GetLevels().size();
+		}
+
+		std::streamsize tableWidth = numMaxGroupName + numMaxSectionName + numMaxCaseName + numMaxThreads + numMaxOperations + numMaxTime + (numMaxRate * 2) +
+			numMaxScaling + 28;
+		std::streamsize titleWidth = tableWidth - 4;
+
+		ReportBuffer report(static_cast<std::size_t>((tableWidth + 1) * (rowsTotal + 7)) + 32);
+		report << console_color::BrightWhite
+			<< std::left
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << string_utils::CenterText("STRESS REPORT (CONTENDED THROUGHPUT)", static_cast<int>(titleWidth)) << " |" << '\n'
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << std::setw(numMaxGroupName) << "GROUP NAME"
+			<< " | " << std::setw(numMaxSectionName) << "SECTION NAME"
+			<< " | " << std::setw(numMaxCaseName) << "CASE NAME"
+			<< " | " << std::setw(numMaxThreads) << "THREADS"
+			<< " | " << std::setw(numMaxOperations) << "OPERATIONS"
+			<< " | " << std::setw(numMaxTime) << "TIME"
+			<< " | " << std::setw(numMaxRate) << "OPS/S"
+			<< " | " << std::setw(numMaxRate) << "OPS/S/THREAD"
+			<< " | " << std::setw(numMaxScaling) << "SCALING"
+			<< " |" << '\n' << std::string(tableWidth, '-') << '\n';
+
+		for (const StressCase* stressCase : stressCases)
+		{
+			// scaling is the throughput relative to the single thread level, ideal scaling equals the thread count
+			const double singleThreadRate = stressCase->GetLevels().empty() ? 0.0 : stressCase->GetLevels().front().OpsPerSecond();
+			for (const StressLevel& level : stressCase->GetLevels())
+			{
+				const double opsPerSecond = level.OpsPerSecond();
+				std::ostringstream strScaling;
+				strScaling << std::setprecision(2) << std::fixed << (singleThreadRate > 0.0 ? opsPerSecond / singleThreadRate : 0.0) << 'x';
+
+				report << "| " << std::setw(numMaxGroupName) << (stressCase->GetGroupName().empty() ? "ungrouped" : stressCase->GetGroupName())
+					<< " | " << std::setw(numMaxSectionName) << (stressCase->GetSectionName().empty() ? "default" : stressCase->GetSectionName())
+					<< " | " << std::setw(numMaxCaseName) << stressCase->GetCaseName()
+					<< " | " << std::setw(numMaxThreads) << level.threads
+					<< " | " << std::setw(numMaxOperations) << level.operations
+					<< " | " << std::setw(numMaxTime) << formatTime(level.elapsed)
+					<< " | " << std::setw(numMaxRate) << formatRate(opsPerSecond)
+					<< " | " << std::setw(numMaxRate) << formatRate(opsPerSecond / static_cast<double>(level.threads))
+					<< " | " << std::setw(numMaxScaling) << strScaling.str()
+					<< " |" << '\n';
+
+				TestRegistry::logFile_ << level.threads
+					<< '\t' << level.operations
+					<< '\t' << level.elapsed.count()
+					<< '\t' << std::setprecision(1) << std::fixed << opsPerSecond
+					<< '\t' << stressCase->GetGroupName()
+					<< '\t' << stressCase->GetSectionName()
+					<< '\t' << stressCase->GetCaseName()
+					<< '\n';
 			}
 		}
-		oss << std::string(tableWidth, '-') << "\n";
-		std::cout << oss.str();
-		oss.str("");
-		oss.clear();
+		report << std::string(tableWidth, '-') << '\n'
+			<< '\n' << console_color::Default;
+		report.Flush();
+		TestRegistry::logFile_ << std::endl;
+	}
 
-		time_utils::double_time totalElapsed = time_utils::ConvertToDouble(casesTotalElapsed);
-		double checkPercentage{ 100.0 * testsPassed / std::max<std::uintmax_t>(1, testsChecked) };
+	const void TestRegistry::ReportAccuracy(const std::vector<AccuracyCase*>& accuracyCases) const noexcept
+	{
+		std::streamsize numMaxGroupName{ 10 }, numMaxSectionName{ 12 }, numMaxCaseName{ 9 }, numMaxSamples{ 7 }, numMaxUlp{ 8 }, numMaxBucket{ 7 },
+			numMaxTime{ 7 }, numMaxSpeedup{ 7 };
+		constexpr const char* bucketNames[] = { "0", "1", "2", "<=4", "<=16", "<=256", ">256" };
+		static_assert(std::size(bucketNames) == std::tuple_size_v<decltype(AccuracyStats::buckets)>);
+		auto formatUlp = [](double ulp)
+			{
+				std::ostringstream strUlp;
+				if (std::isinf(ulp))
+					strUlp << "inf";
+				else
+					strUlp << std::setprecision(ulp < 1e6 ? 2 : 1) << (ulp < 1e6 ? std::fixed : std::scientific) << ulp;
+				return strUlp.str();
+			};
+		auto formatPercent = [](std::uint64_t count, std::uint64_t total)
+			{
+				std::ostringstream strPercent;
+				strPercent << std::setprecision(2) << std::fixed << (total > 0 ? 100.0 * static_cast<double>(count) / static_cast<double>(total) : 0.0) << '%';
+				return strPercent.str();
+			};
+		auto formatNs = [](double nanoseconds)
+			{
+				std::ostringstream strNs;
+				strNs << std::setprecision(2) << std::fixed << nanoseconds;
+				return strNs.str();
+			};
 
-		oss << '\n' << "Total Running Time: " << std::setprecision(2) << std::fixed << totalElapsed.time << ' ' << totalElapsed.unit
-			<< '\n' << std::setprecision(1) << std::fixed << testsPassed << '/' << testsChecked << " tests (" << checkPercentage << "%)\n"
-			<< casesPassed << '/' << casesTotal << " cases (" << std::setprecision(1) << std::fixed << (casesTotal ? 100.0 * casesPassed / casesTotal : 0.0) << "%)\n"
-			<< score << " of " << maxScore << " score (" << std::setprecision(1) << std::fixed << (maxScore > 0.0 ? score * 100 / maxScore : 0.0) << "%)\n";
-		std::cout << oss.str() << std::endl;
-		TestRegistry::logFile_ << oss.str() << std::endl;
-		std::cout << console_color::Default;
-		oss.str("");
-		oss.clear();
+		std::size_t worstTotal = 0;
+		for (const AccuracyCase* accuracyCase : accuracyCases)
+		{
+			const AccuracyStats& stats = accuracyCase->GetStats();
+			numMaxGroupName = stream_utils::MaxStreamSize(accuracyCase->GetGroupName().size(), numMaxGroupName);
+			numMaxSectionName = stream_utils::MaxStreamSize(accuracyCase->GetSectionName().size(), numMaxSectionName);
+			numMaxCaseName = stream_utils::MaxStreamSize(accuracyCase->GetCaseName().size(), numMaxCaseName);
+			numMaxSamples = stream_utils::MaxStreamSize(std::to_string(stats.samples).size(), numMaxSamples);
+			numMaxUlp = stream_utils::MaxStreamSize(formatUlp(stats.maxUlp).size(), numMaxUlp);
+			numMaxUlp = stream_utils::MaxStreamSize(formatUlp(stats.MeanUlp()).size(), numMaxUlp);
+			numMaxTime = stream_utils::MaxStreamSize(formatNs(stats.nsPerCall).size(), numMaxTime);
+			numMaxTime = stream_utils::MaxStreamSize(formatNs(stats.referenceNsPerCall).size(), numMaxTime);
+			worstTotal += stats.worst.size();
+		}
+
+		const std::streamsize bucketCount = static_cast<std::streamsize>(std::size(bucketNames));
+		std::streamsize tableWidth = numMaxGroupName + numMaxSectionName + numMaxCaseName + numMaxSamples + (numMaxUlp * 2) + (numMaxBucket * bucketCount) +
+			(numMaxTime * 2) + numMaxSpeedup + 3 * (9 + bucketCount) + 1;
+		std::streamsize titleWidth = tableWidth - 4;
+
+		ReportBuffer report(static_cast<std::size_t>((tableWidth + 1) * (accuracyCases.size() + 10)) + (worstTotal * 160) + 64);
+		report << console_color::BrightWhite
+			<< std::left
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << string_utils::CenterText("ACCURACY REPORT (ULP ERROR VS REFERENCE)", static_cast<int>(titleWidth)) << " |" << '\n'
+			<< std::string(tableWidth, '=') << '\n'
+			<< "| " << std::setw(numMaxGroupName) << "GROUP NAME"
+			<< " | " << std::setw(numMaxSectionName) << "SECTION NAME"
+			<< " | " << std::setw(numMaxCaseName) << "CASE NAME"
+			<< " | " << std::setw(numMaxSamples) << "SAMPLES"
+			<< " | " << std::setw(numMaxUlp) << "MAX ULP"
+			<< " | " << std::setw(numMaxUlp) << "MEAN ULP";
+		for (const char* bucketName : bucketNames)
+			report << " | " << std::setw(numMaxBucket) << bucketName;
+		report << " | " << std::setw(numMaxTime) << "NS/CALL"
+			<< " | " << std::setw(numMaxTime) << "REF NS"
+			<< " | " << std::setw(numMaxSpeedup) << "SPEEDUP"
+			<< " |" << '\n' << std::string(tableWidth, '-') << '\n';
+
+		for (const AccuracyCase* accuracyCase : accuracyCases)
+		{
+			// speedup above 1.00x means the function under test is faster than the reference
+			const AccuracyStats& stats = accuracyCase->GetStats();
+			std::ostringstream strSpeedup;
+			strSpeedup << std::setprecision(2) << std::fixed << (stats.nsPerCall > 0.0 ? stats.referenceNsPerCall / stats.nsPerCall : 0.0) << 'x';
+
+			report << "| " << std::setw(numMaxGroupName) << (accuracyCase->GetGroupName().empty() ? "ungrouped" : accuracyCase->GetGroupName())
+				<< " | " << std::setw(numMaxSectionName) << (accuracyCase->GetSectionName().empty() ? "default" : accuracyCase->GetSectionName())
+				<< " | " << std::setw(numMaxCaseName) << accuracyCase->GetCaseName()
+				<< " | " << std::setw(numMaxSamples) << stats.samples
+				<< " | " << std::setw(numMaxUlp) << formatUlp(stats.maxUlp)
+				<< " | " << std::setw(numMaxUlp) << formatUlp(stats.MeanUlp());
+			for (std::uint64_t bucket : stats.buckets)
+				report << " | " << std::setw(numMaxBucket) << formatPercent(bucket, stats.samples);
+			report << " | " << std::setw(numMaxTime) << formatNs(stats.nsPerCall)
+				<< " | " << std::setw(numMaxTime) << formatNs(stats.referenceNsPerCall)
+				<< " | " << std::setw(numMaxSpeedup) << strSpeedup.str()
+				<< " |" << '\n';
+
+			TestRegistry::logFile_ << stats.samples
+				<< '\t' << stats.maxUlp
+				<< '\t' << stats.MeanUlp()
+				<< '\t' << stats.mismatches
+				<< '\t' << std::setprecision(2) << std::fixed << stats.nsPerCall
+				<< '\t' << stats.referenceNsPerCall << std::defaultfloat
+				<< '\t' << accuracyCase->GetGroupName()
+				<< '\t' << accuracyCase->GetSectionName()
+				<< '\t' << accuracyCase->GetCaseName()
+				<< '\n';
+		}
+		report << std::string(tableWidth, '-') << '\n';
+
+		// the worst inputs show where an implementation breaks down, e.g. a range reduction boundary or a series that stops too early
+		if (worstTotal > 0)
+		{
+			report << "WORST INPUTS:" << '\n';
+			for (const AccuracyCase* accuracyCase : accuracyCases)
+			{
+				for (const AccuracyWorst& worst : accuracyCase->GetStats().worst)
+				{
+					std::ostringstream strWorst;
+					strWorst << std::setprecision(17) << "  " << accuracyCase->GetCaseName() << ": x = " << worst.input << ", value = "
+						<< static_cast<double>(worst.value) << ", reference = " << static_cast<double>(worst.reference) << ", " << formatUlp(worst.ulp) << " ULP" << '\n';
+					report << strWorst.str();
+					TestRegistry::logFile_ << strWorst.str();
+				}
+			}
+		}
+		report << '\n' << console_color::Default;
+		report.Flush();
+		TestRegistry::logFile_ << std::endl;
+	}
+
+	void TestRegistry::CompareBaseline(const std::vector<BenchmarkCase*>& benchmarkCases) const
+	{
+		BenchmarkBaseline baseline;
+		bool isBaselineChanged = !baseline.Load(options_.baselinePath) || options_.updateBaseline;
+
+		for (BenchmarkCase* benchmarkCase : benchmarkCases)
+		{
+			const BenchmarkStats* baselineStats = baseline.Find(*benchmarkCase);
+			if (baselineStats)
+				benchmarkCase->SetComparison(BenchmarkBaseline::Compare(*baselineStats, benchmarkCase->GetStats(), options_.regressionThreshold, options_.regressionSignificance));
+
+			// new cases are always recorded, existing entries only when explicitly asked to so a regression can never overwrite its own baseline
+			if (!baselineStats || options_.updateBaseline)
+			{
+				baseline.Update(*benchmarkCase);
+				isBaselineChanged = true;
+			}
+		}
+
+		if (isBaselineChanged && !baseline.Save(options_.baselinePath))
+		{
+			std::ostringstream oss;
+			oss << "TestRegistry::CompareBaseline() : Baseline file could not be written: " << options_.baselinePath.string() << '\n';
+			std::cout << oss.str();
+			if (TestRegistry::logFile_.is_open())
+				TestRegistry::logFile_ << oss.str();
+		}
+	}
+
+	void TestRegistry::UpdateHistory(TestHistory& history, const std::vector<TestCase*>& testCases) const
+	{
+		for (const TestCase* testCase : testCases)
+			history.Update(*testCase, IsCaseFailed(testCase));
+
+		if (!history.Save(options_.historyPath))
+		{
+			std::ostringstream oss;
+			oss << "TestRegistry::UpdateHistory() : History file could not be written: " << options_.historyPath.string() << '\n';
+			std::cout << oss.str();
+			if (TestRegistry::logFile_.is_open())
+				TestRegistry::logFile_ << oss.str();
+		}
 	}
 
 	void TestRegistry::Cleanup()
@@ -310,11 +1366,7 @@ namespace winxframe
 		if (TestRegistry::logFile_)
 			TestRegistry::logFile_.close();
 
-		if (TestRegistry::currentCasePtr_)
-		{
-			delete TestRegistry::currentCasePtr_;
-			TestRegistry::currentCasePtr_ = nullptr;
-		}
+		TestRegistry::currentCasePtr_ = nullptr;
 
 		if (TestRegistry::casesPtr_)
 		{
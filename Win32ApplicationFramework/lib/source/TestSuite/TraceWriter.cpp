@@ -0,0 +1,149 @@
+/*!
+lib\source\TestSuite\TraceWriter.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Trace Writer source file.
+*/
+
+#include <TestSuite/TraceWriter.hpp>
+#include <win32/framework.h>
+
+namespace winxframe
+{
+	namespace
+	{
+		/* Appends a JSON string literal, escaping quotes, backslashes, and control characters */
+		void AppendJsonString(std::string& out, std::string_view text)
+		{
+			out += '"';
+			for (const char ch : text)
+			{
+				switch (ch)
+				{
+				case '"': out += "\\\""; break;
+				case '\\': out += "\\\\"; break;
+				case '\n': out += "\\n"; break;
+				case '\r': out += "\\r"; break;
+				case '\t': out += "\\t"; break;
+				default:
+					if (static_cast<unsigned char>(ch) < 0x20)
+					{
+						char escaped[8];
+						std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(static_cast<unsigned char>(ch)));
+						out += escaped;
+					}
+					else
+						out += ch;
+				}
+			}
+			out += '"';
+		}
+
+		/* Appends a duration as microseconds with nanosecond precision, the unit of the trace-event format */
+		void AppendMicroseconds(std::string& out, std::chrono::nanoseconds duration)
+		{
+			char text[32];
+			std::snprintf(text, sizeof(text), "%.3f", static_cast<double>(duration.count()) / 1000.0);
+			out += text;
+		}
+	}
+
+	std::atomic<TraceWriter*> TraceWriter::active_{ nullptr };
+
+	/* CONSTRUCTOR */
+
+	TraceWriter::TraceWriter(const std::filesystem::path& path) :
+		file_(path, std::ios::trunc),
+		origin_(std::chrono::high_resolution_clock::now())
+	{
+		if (!file_)
+			return;
+
+		file_ << "[\n";
+		std::string event = "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(GetCurrentProcessId()) + ",\"tid\":0,\"args\":{\"name\":\"winxframe tests\"}}";
+		this->WriteEvent(event);
+
+		TraceWriter* expected = nullptr;
+		active_.compare_exchange_strong(expected, this, std::memory_order_acq_rel);
+	}
+
+	TraceScope::TraceScope(std::string_view name, std::string_view category) :
+		writer_(TraceWriter::Active()),
+		category_(category)
+	{
+		if (!writer_)
+			return;
+		name_ = name;
+		start_ = std::chrono::high_resolution_clock::now();
+	}
+
+	/* DESTRUCTOR */
+
+	TraceWriter::~TraceWriter()
+	{
+		TraceWriter* expected = this;
+		active_.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel);
+		if (file_.is_open())
+			file_ << "\n]\n";
+	}
+
+	TraceScope::~TraceScope()
+	{
+		if (writer_)
+			writer_->WriteComplete(name_, category_, start_, std::chrono::high_resolution_clock::now(), args_);
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void TraceWriter::WriteEvent(const std::string& event)
+	{
+		std::lock_guard<std::mutex> lock(mutex_);
+		if (!isFirst_)
+			file_ << ",\n";
+		file_ << event;
+		isFirst_ = false;
+	}
+
+	void TraceWriter::WriteComplete(std::string_view name, std::string_view category, time_point start, time_point stop, std::string_view args)
+	{
+		// the event is formatted before taking the lock so concurrent threads only serialize on the file write
+		std::string event;
+		event.reserve(128 + name.size() + args.size());
+		event += "{\"name\":";
+		AppendJsonString(event, name);
+		event += ",\"cat\":";
+		AppendJsonString(event, category);
+		event += ",\"ph\":\"X\",\"ts\":";
+		AppendMicroseconds(event, start - origin_);
+		event += ",\"dur\":";
+		AppendMicroseconds(event, stop - start);
+		event += ",\"pid\":" + std::to_string(GetCurrentProcessId()) + ",\"tid\":" + std::to_string(GetCurrentThreadId());
+		if (!args.empty())
+		{
+			event += ",\"args\":{";
+			event += args;
+			event += '}';
+		}
+		event += '}';
+		this->WriteEvent(event);
+	}
+
+	void TraceWriter::AppendArg(std::string& args, std::string_view key, std::string_view value)
+	{
+		if (!args.empty())
+			args += ',';
+		AppendJsonString(args, key);
+		args += ':';
+		AppendJsonString(args, value);
+	}
+
+	void TraceWriter::AppendArg(std::string& args, std::string_view key, std::uint64_t value)
+	{
+		if (!args.empty())
+			args += ',';
+		AppendJsonString(args, key);
+		args += ':' + std::to_string(value);
+	}
+}; // end of namespace winxframe
@@ -0,0 +1,138 @@
+/*!
+lib\source\TestSuite\WorkStealingPool.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Work Stealing Pool source file.
+
+\note
+Each worker owns a deque; it pops its own work from the back (LIFO, cache-warm) while idle workers steal from the front (FIFO, oldest work)
+of the other queues. A queue is only ever touched under its own mutex, so contention is limited to the rare steal.
+*/
+
+#include <TestSuite/WorkStealingPool.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace winxframe
+{
+	/* STATIC DEFINITIONS */
+
+	thread_local const WorkStealingPool* WorkStealingPool::ownerPool_ = nullptr;
+	thread_local std::size_t WorkStealingPool::workerIndex_ = std::numeric_limits<std::size_t>::max();
+
+	/* CONSTRUCTOR */
+
+	WorkStealingPool::WorkStealingPool(std::size_t threadCount)
+	{
+		if (threadCount == 0)
+			threadCount = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+
+		queues_.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i)
+			queues_.push_back(std::make_unique<WorkQueue>());
+
+		workers_.reserve(threadCount);
+		for (std::size_t i = 0; i < threadCount; ++i)
+			workers_.emplace_back(&WorkStealingPool::WorkerLoop, this, i);
+	}
+
+	/* DESTRUCTOR */
+
+	WorkStealingPool::~WorkStealingPool()
+	{
+		this->Wait();
+		{
+			std::lock_guard<std::mutex> lock(wakeMutex_);
+			isStopping_ = true;
+		}
+		wakeCondition_.notify_all();
+
+		for (std::thread& worker : workers_)
+			if (worker.joinable())
+				worker.join();
+	}
+
+	/* FUNCTION DEFINITIONS */
+
+	void WorkStealingPool::Submit(Task task)
+	{
+		const std::size_t index = (ownerPool_ == this) ? workerIndex_ : nextQueue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+
+		pendingTasks_.fetch_add(1, std::memory_order_acq_rel);
+		{
+			// count the task before it becomes visible so a worker can never decrement past zero
+			std::lock_guard<std::mutex> lock(wakeMutex_);
+			queuedTasks_.fetch_add(1, std::memory_order_acq_rel);
+		}
+		{
+			std::lock_guard<std::mutex> lock(queues_[index]->mutex);
+			queues_[index]->tasks.push_back(std::move(task));
+		}
+		wakeCondition_.notify_one();
+	}
+
+	void WorkStealingPool::Wait()
+	{
+		std::unique_lock<std::mutex> lock(wakeMutex_);
+		idleCondition_.wait(lock, [this] { return pendingTasks_.load(std::memory_order_acquire) == 0; });
+	}
+
+	void WorkStealingPool::WorkerLoop(std::size_t index)
+	{
+		ownerPool_ = this;
+		workerIndex_ = index;
+
+		Task task;
+		while (true)
+		{
+			if (this->TryPop(index, task) || this->TrySteal(index, task))
+			{
+				queuedTasks_.fetch_sub(1, std::memory_order_acq_rel);
+				task();
+				task = nullptr;
+
+				if (pendingTasks_.fetch_sub(1, std::memory_order_acq_rel) == 1)
+				{
+					std::lock_guard<std::mutex> lock(wakeMutex_);
+					idleCondition_.notify_all();
+				}
+				continue;
+			}
+
+			std::unique_lock<std::mutex> lock(wakeMutex_);
+			wakeCondition_.wait(lock, [this] { return isStopping_ || queuedTasks_.load(std::memory_order_acquire) > 0; });
+			if (isStopping_ && queuedTasks_.load(std::memory_order_acquire) == 0)
+				return;
+		}
+	}
+
+	bool WorkStealingPool::TryPop(std::size_t index, Task& task)
+	{
+		WorkQueue& queue = *queues_[index];
+		std::lock_guard<std::mutex> lock(queue.mutex);
+		if (queue.tasks.empty())
+			return false;
+
+		task = std::move(queue.tasks.back());
+		queue.tasks.pop_back();
+		return true;
+	}
+
+	bool WorkStealingPool::TrySteal(std::size_t index, Task& task)
+	{
+		for (std::size_t offset = 1; offset < queues_.size(); ++offset)
+		{
+			WorkQueue& victim = *queues_[(index + offset) % queues_.size()];
+			std::unique_lock<std::mutex> lock(victim.mutex, std::try_to_lock);
+			if (!lock.owns_lock() || victim.tasks.empty())
+				continue;
+
+			task = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			return true;
+		}
+		return false;
+	}
+}; // end of namespace winxframe
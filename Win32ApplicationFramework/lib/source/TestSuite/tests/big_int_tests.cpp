@@ -0,0 +1,174 @@
+/*!
+lib\source\TestSuite\tests\big_int_tests.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Big Integer Tests source file.
+*/
+
+#include <TestSuite/test_macros.hpp>
+#include <utils/big_int.hpp>
+#include <random>
+#include <string>
+#include <utility>
+
+namespace winxframe
+{
+	using namespace math_utils;
+
+	namespace
+	{
+		/* Random decimal digits, the first one non-zero */
+		std::string RandomDigits(std::mt19937_64& engine, std::size_t count)
+		{
+			std::string digits(count, '0');
+			for (char& digit : digits)
+				digit = static_cast<char>('0' + engine() % 10);
+			digits[0] = static_cast<char>('1' + engine() % 9);
+			return digits;
+		}
+
+		/* |value| mod p through the single limb division, reduced into [0, p) for negative values */
+		unsigned long long Residue(const BigInt& value, unsigned long long p)
+		{
+			const BigInt remainder = value % BigInt(p);
+			const unsigned long long magnitude = std::stoull((remainder.IsNegative() ? -remainder : remainder).ToString());
+			return remainder.IsNegative() && magnitude != 0 ? p - magnitude : magnitude;
+		}
+	}
+
+	TEST_CASE(ut_big_int_01, "Big Integer Tests", "Small Buffer")
+	{
+		/* values up to 128 bits, growth past the inline limbs, copies and moves */
+		BigInt a = ~0ULL;
+		CHECK(a.LimbCount() == 1);
+		a += 1;
+		CHECK(a.LimbCount() == 2);
+		CHECK(a.ToString() == "18446744073709551616");
+		a *= a;
+		CHECK(a.LimbCount() == 3);
+		CHECK(a.ToString() == "340282366920938463463374607431768211456");
+
+		BigInt copy = a;
+		BigInt moved = std::move(copy);
+		CHECK(moved == a);
+		copy = moved;
+		CHECK(copy == a);
+		copy = BigInt(5);
+		CHECK(copy.LimbCount() == 1);
+		moved = std::move(copy);
+		CHECK(moved == BigInt(5));
+
+		// operands aliasing the result
+		BigInt b = a;
+		b += b;
+		CHECK(b == a * 2);
+		b -= b;
+		CHECK(b.IsZero());
+		b = a;
+		b *= b;
+		CHECK(b == a * a);
+		b /= b;
+		CHECK(b == BigInt(1));
+	}
+
+	TEST_CASE(ut_big_int_02, "Big Integer Tests", "Arithmetic")
+	{
+		/* products and quotients checked modulo a prime, the sizes cross the Karatsuba threshold and the unbalanced split */
+		const unsigned long long p = 2'305'843'009'213'693'951ULL;    // 2^61 - 1
+		const ModContext context(p);
+		std::mt19937_64 engine(20261016);
+		for (const std::size_t digits : { 5, 19, 20, 39, 200, 900, 1'000, 2'000, 6'000, 20'000 })
+		{
+			const BigInt a = BigInt::FromString(RandomDigits(engine, digits));
+			const BigInt b = -BigInt::FromString(RandomDigits(engine, digits / 3 + 1));
+			const BigInt c = BigInt::FromString(RandomDigits(engine, digits + 7));
+			const unsigned long long ra = Residue(a, p), rb = Residue(b, p), rc = Residue(c, p);
+			CHECK(Residue(a * b, p) == context.MulMod(ra, rb));
+			CHECK(Residue(a * c, p) == context.MulMod(ra, rc));
+			CHECK(Residue(a + b, p) == context.AddMod(ra, rb));
+			CHECK(Residue(b - c, p) == context.SubMod(rb, rc));
+
+			// truncating division: a = q * b + r, |r| < |b|, r takes the sign of a
+			BigInt q, r;
+			BigInt::DivMod(a, b, q, r);
+			CHECK(q * b + r == a);
+			CHECK(!r.IsNegative() && r < -b);
+			CHECK(q.IsNegative());
+			BigInt::DivMod(-(a * c) - 1, c, q, r);
+			CHECK(q == -a && r == BigInt(-1));
+			CHECK((a * c) / c == a);
+			CHECK((a * c + b) % c == c + b);
+		}
+
+		// quotient limbs estimated from a divisor whose top limbs are all ones
+		const BigInt allOnes = Pow(BigInt(2), 256) - 1;
+		const BigInt dividend = Pow(BigInt(2), 640) - 3;
+		CHECK(dividend / allOnes * allOnes + dividend % allOnes == dividend);
+
+		// Burnikel-Ziegler sizes: odd divisor sizes padded to an even split, quotients on both sides of the threshold, all-ones divisors
+		for (const std::size_t divisorLimbs : { 48, 49, 97, 128, 301 })
+		{
+			for (const std::size_t quotientLimbs : { 47, 48, 130, 700 })
+			{
+				const BigInt large = BigInt::FromString(RandomDigits(engine, (divisorLimbs + quotientLimbs) * 19));
+				for (const BigInt& divisor : { BigInt::FromString(RandomDigits(engine, divisorLimbs * 19)), Pow(BigInt(2), 64 * divisorLimbs) - 1 })
+				{
+					BigInt q, r;
+					BigInt::DivMod(large, divisor, q, r);
+					CHECK(q * divisor + r == large);
+					CHECK(!r.IsNegative() && r < divisor);
+					CHECK((q * divisor + divisor - 1) / divisor == q);
+				}
+			}
+		}
+
+		CHECK(BigInt(-7) / 2 == BigInt(-3));
+		CHECK(BigInt(-7) % 2 == BigInt(-1));
+		CHECK(BigInt(7) % -2 == BigInt(1));
+		CHECK(BigInt(3) / 7 == BigInt(0));
+	}
+
+	TEST_CASE(ut_big_int_03, "Big Integer Tests", "Decimal Conversion")
+	{
+		/* ToString and FromString, both sides of the divide-and-conquer size */
+		std::mt19937_64 engine(1016);
+		for (const std::size_t digits : { 1, 18, 19, 20, 38, 600, 700, 5'000, 50'000 })
+		{
+			const std::string text = RandomDigits(engine, digits);
+			CHECK(BigInt::FromString(text).ToString() == text);
+			CHECK(BigInt::FromString("-" + text).ToString() == "-" + text);
+		}
+
+		// chunks of zeros inside the value keep their padding
+		const std::string sparse = "1" + std::string(3'000, '0') + "7" + std::string(1'000, '0');
+		CHECK(BigInt::FromString(sparse).ToString() == sparse);
+		CHECK(BigInt::FromString(sparse) == Pow(BigInt(10), 4'001) + 7 * Pow(BigInt(10), 1'000));
+		CHECK(BigInt::FromString("000123") == BigInt(123));
+		CHECK(!BigInt::FromString("-0").IsNegative());
+		CHECK(BigInt(0).ToString() == "0");
+		CHECK(Pow(BigInt(2), 1'000).ToString() == "10715086071862673209484250490600018105614048117055336074437503883703510511249361224931983788156958581275946729175531468251871452856923140435984577574698574803934567774824230985421074605062371141877954182153046474983581941267398767559165543946077062914571196477686542167660429831652624386837205668069376");
+	}
+
+	TEST_CASE(ut_big_int_04, "Big Integer Tests", "Factorial, Pow, GCD")
+	{
+		/* Factorial<BigInt> */
+		for (int n = 0; n <= 20; ++n)
+			CHECK(Factorial<BigInt>(n) == BigInt(Factorial(n)));
+		CHECK(Factorial<BigInt>(100).ToString() == "93326215443944152681699238856266700490715968264381621468592963895217599993229915608941463976156518286253697920827223758251185210916864000000000000000000000000");
+		CHECK(Residue(Factorial<BigInt>(1'000), 1'000'000'007ULL) == 641'419'708ULL);
+
+		/* Pow */
+		CHECK(Pow(BigInt(3), 200).ToString() == "265613988875874769338781322035779626829233452653394495974574961739092490901302182994384699044001");
+		CHECK(Pow(BigInt(-2), 63) == BigInt(std::numeric_limits<long long>::min()));
+		CHECK(Pow(BigInt(0), 0) == BigInt(1));
+
+		/* GCD, GCD(F(a), F(b)) = F(GCD(a, b)) */
+		CHECK(GCD(Fibonacci<BigInt>(3'000), Fibonacci<BigInt>(4'500)) == Fibonacci<BigInt>(1'500));
+		CHECK(GCD(Factorial<BigInt>(300), Pow(BigInt(2), 1'000)) == Pow(BigInt(2), 296));
+		CHECK(GCD(BigInt(-12), BigInt(18)) == BigInt(6));
+		CHECK(GCD(BigInt(0), BigInt(-5)) == BigInt(5));
+		CHECK(GCD(BigInt(0), BigInt(0)).IsZero());
+	}
+}; // end of namespace winxframe
@@ -0,0 +1,55 @@
+/*!
+lib\source\TestSuite\tests\math_accuracy.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Math Accuracy source file.
+*/
+
+#include <TestSuite/test_macros.hpp>
+#include <utils/math_utils.hpp>
+#include <cfloat>
+
+namespace winxframe
+{
+	using namespace math_utils;
+	using accuracy::unbounded;
+
+	/* Exp, within 1 ULP of the reference for every floating type */
+	ACCURACY_CASE(ac_math_01, double, Exp(x), std::exp(x), -700.0, 700.0, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_02, float, Exp(x), std::exp(x), -87.0f, 88.0f, 1.0, "Math Accuracy", "Exponentiation");
+
+	/* Log */
+	ACCURACY_CASE(ac_math_03, double, Log(x), std::log(x), 1e-300, 1e300, 1.0, "Math Accuracy", "Natural Logarithm");
+	ACCURACY_CASE(ac_math_04, float, Log(x), std::log(x), 1e-37f, 1e37f, 1.0, "Math Accuracy", "Natural Logarithm");
+
+	/* Pow, integral exponent */
+	ACCURACY_CASE(ac_math_05, double, Pow(x, 2), std::pow(x, 2), 1e-100, 1e100, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_06, double, Pow(x, 10), std::pow(x, 10), 1e-30, 1e30, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_07, double, Pow(x, -7), std::pow(x, -7), 1e-40, 1e40, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_10, double, Pow(x, 173), std::pow(x, 173), 0.02, 60.0, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_11, float, Pow(x, -13), std::pow(x, -13), -400.0f, -0.002f, 1.0, "Math Accuracy", "Exponentiation");
+
+	/* Pow, real exponent, including |y * ln(x)| close to the overflow threshold */
+	ACCURACY_CASE(ac_math_12, double, Pow(x, 2.5), std::pow(x, 2.5), 1e-120, 1e120, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_13, double, Pow(1.0001, x), std::pow(1.0001, x), -7e6, 7e6, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_14, double, Pow(0.7071, x), std::pow(0.7071, x), -2000.0, 2000.0, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_15, float, Pow(x, 1.75f), std::pow(x, 1.75f), 1e-20f, 1e20f, 1.0, "Math Accuracy", "Exponentiation");
+
+	/* Pow, integral exponent, results within a few binades of the overflow threshold and of the subnormal range */
+	ACCURACY_CASE(ac_math_17, double, Pow(x, 512), std::pow(x, 512), 3.9, 4.0, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_18, double, Pow(x, -512), std::pow(x, -512), 3.9, 4.1, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_19, float, Pow(x, -829), std::pow(x, -829), 0.89f, 0.9f, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_20, float, Pow(x, 829), std::pow(x, 829), 0.89f, 0.9f, 1.0, "Math Accuracy", "Exponentiation");
+
+	/*
+	* 80-bit long double, results beyond the range and precision of double. Where long double is double (MSVC) these cases would only repeat
+	* the double cases above, so they are not compiled.
+	*/
+	#if LDBL_MANT_DIG > DBL_MANT_DIG
+	ACCURACY_CASE(ac_math_08, long double, Exp(x), std::exp(x), -11000.0L, 11000.0L, 1.0, "Math Accuracy", "Exponentiation");
+	ACCURACY_CASE(ac_math_09, long double, Log(x), std::log(x), 1e-300L, 1e300L, 1.0, "Math Accuracy", "Natural Logarithm");
+	ACCURACY_CASE(ac_math_16, long double, Pow(x, -3.3L), std::pow(x, -3.3L), 1e-300L, 1e300L, 1.0, "Math Accuracy", "Exponentiation");
+	#endif
+}; // end of namespace winxframe
@@ -0,0 +1,154 @@
+/*!
+lib\source\TestSuite\tests\math_batch_tests.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Math Batch Tests source file.
+*/
+
+#include <TestSuite/test_macros.hpp>
+#include <utils/math_batch.hpp>
+#include <bit>
+#include <random>
+#include <vector>
+
+namespace winxframe
+{
+	using namespace math_utils;
+
+	namespace
+	{
+		/* Returns the index of the first element whose bits differ, or the size when all match */
+		template <typename T>
+		std::size_t FirstBitMismatch(const std::vector<T>& values, const std::vector<T>& expected)
+		{
+			for (std::size_t i = 0; i < values.size(); ++i)
+			{
+				if constexpr (sizeof(T) == sizeof(std::uint32_t))
+				{
+					if (std::bit_cast<std::uint32_t>(values[i]) != std::bit_cast<std::uint32_t>(expected[i]))
+						return i;
+				}
+				else if (std::bit_cast<std::uint64_t>(values[i]) != std::bit_cast<std::uint64_t>(expected[i]))
+					return i;
+			}
+			return values.size();
+		}
+
+		/* Special values first, then random values spread over the binades between low and high (both signs when low < 0) */
+		template <typename T>
+		std::vector<T> BatchInputs(T low, T high, std::size_t count)
+		{
+			constexpr T infinity = std::numeric_limits<T>::infinity();
+			std::vector<T> values = {
+				T(0), -T(0), T(1), -T(1), T(0.5), T(2), infinity, -infinity, std::numeric_limits<T>::quiet_NaN(), -std::numeric_limits<T>::quiet_NaN(),
+				std::numeric_limits<T>::min(), std::numeric_limits<T>::denorm_min(), -std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(),
+				std::numeric_limits<T>::epsilon(), -std::numeric_limits<T>::epsilon(), low, high
+			};
+
+			std::mt19937_64 engine(20261016);
+			const T magnitudeLow = low > T(0) ? low : std::numeric_limits<T>::min();
+			const T magnitudeHigh = Max(Abs(low), Abs(high));
+			std::uniform_real_distribution<double> exponent(std::log2(static_cast<double>(magnitudeLow)), std::log2(static_cast<double>(magnitudeHigh)));
+			while (values.size() < count)
+			{
+				const T magnitude = static_cast<T>(std::exp2(exponent(engine)));
+				values.push_back(low < T(0) && (engine() & 1) ? -magnitude : magnitude);
+			}
+			return values;
+		}
+
+		/* Compares a batch function with the scalar one over inputs at the active SIMD level, scalar(i) returns the expected out[i] */
+		template <typename T, typename Batch, typename Scalar>
+		void CheckBatchBits(const std::vector<T>& inputs, Batch batch, Scalar scalar, const char* name)
+		{
+			std::vector<T> values(inputs.size()), expected(inputs.size());
+			batch(std::span<const T>(inputs), std::span<T>(values));
+			for (std::size_t i = 0; i < inputs.size(); ++i)
+				expected[i] = scalar(i);
+
+			const std::size_t mismatch = FirstBitMismatch(values, expected);
+			std::ostringstream oss;
+			oss << name << " at " << GetSimdLevel() << " differs from the scalar result";
+			if (mismatch < inputs.size())
+				oss << " at x = " << std::setprecision(17) << inputs[mismatch] << ": " << values[mismatch] << " != " << expected[mismatch];
+			MSG_CHECK(mismatch == inputs.size(), oss.str());
+		}
+
+		template <typename T>
+		void CheckBatchFunctions()
+		{
+			// 1003 values leave a tail for every register width
+			constexpr std::size_t count = 1003;
+			const std::vector<T> expInputs = BatchInputs<T>(-T(800), T(800), count);
+			CheckBatchBits(expInputs, [](std::span<const T> x, std::span<T> out) { Exp(x, out); }, [&](std::size_t i) { return Exp(expInputs[i]); }, "Exp");
+
+			// batch Log does not assert, negative inputs give NaN and zeros -inf
+			std::vector<T> logInputs = BatchInputs<T>(std::numeric_limits<T>::denorm_min(), std::numeric_limits<T>::max(), count);
+			for (std::size_t i = 0; i < count; i += 7)
+				logInputs[i] = -logInputs[i];
+			CheckBatchBits(logInputs, [](std::span<const T> x, std::span<T> out) { Log(x, out); }, [&](std::size_t i)
+				{
+					const T x = logInputs[i];
+					if (x > T(0))
+						return Log(x);
+					if (x != x)
+						return x;
+					return x == T(0) ? -std::numeric_limits<T>::infinity() : std::numeric_limits<T>::quiet_NaN();
+				}, "Log");
+
+			const std::vector<T> powInputs = BatchInputs<T>(-T(1e6), T(1e6), count);
+			for (const T exponent : { T(1), T(-1), T(2), T(3), T(-3), T(7), T(0.5), T(2.5), T(-0.75), T(65), T(-101), T(1e-30), T(1e3), T(-40.25), T(0),
+				std::numeric_limits<T>::infinity(), std::numeric_limits<T>::quiet_NaN() })
+			{
+				CheckBatchBits(powInputs, [exponent](std::span<const T> x, std::span<T> out) { Pow(x, exponent, out); },
+					[&](std::size_t i) { return Pow(powInputs[i], exponent); }, "Pow");
+			}
+
+			CheckBatchBits(powInputs, [](std::span<const T> x, std::span<T> out) { Abs(x, out); }, [&](std::size_t i) { return Abs(powInputs[i]); }, "Abs");
+			CheckBatchBits(powInputs, [](std::span<const T> x, std::span<T> out) { Clamp(x, T(-10), T(1000), out); },
+				[&](std::size_t i) { return Clamp(powInputs[i], T(-10), T(1000)); }, "Clamp");
+
+			// Min and Max against the reversed inputs, NaNs and signed zeros included
+			const std::vector<T> others(powInputs.rbegin(), powInputs.rend());
+			CheckBatchBits(powInputs, [&](std::span<const T> x, std::span<T> out) { Min(x, std::span<const T>(others), out); },
+				[&](std::size_t i) { return Min(powInputs[i], others[i]); }, "Min");
+			CheckBatchBits(powInputs, [&](std::span<const T> x, std::span<T> out) { Max(x, std::span<const T>(others), out); },
+				[&](std::size_t i) { return Max(powInputs[i], others[i]); }, "Max");
+		}
+	}
+
+	TEST_CASE(ut_math_batch_01, "Math Batch Tests", "SIMD Dispatch")
+	{
+		/* DetectSimdLevel, GetSimdLevel, SetSimdLevel */
+		const SimdLevel detected = DetectSimdLevel();
+		CHECK(GetSimdLevel() <= detected);
+		SetSimdLevel(SimdLevel::AVX512);
+		CHECK(GetSimdLevel() == detected);
+		SetSimdLevel(SimdLevel::Scalar);
+		CHECK(GetSimdLevel() == SimdLevel::Scalar);
+		SetSimdLevel(detected);
+
+		// empty spans and spans shorter than one register
+		std::vector<double> empty;
+		Exp(std::span<const double>(empty), std::span<double>(empty));
+		std::vector<float> single = { 0.0f }, out(1);
+		Exp(std::span<const float>(single), std::span<float>(out));
+		CHECK(out[0] == 1.0f);
+	}
+
+	TEST_CASE_VALUES(ut_math_batch_02, "Math Batch Tests", "Bitwise Agreement", SimdLevel,
+		{ SimdLevel::Scalar, SimdLevel::SSE2, SimdLevel::AVX2, SimdLevel::AVX512 })
+	{
+		/* Exp, Log, Pow, Abs, Clamp, Min, Max: every level gives the scalar bits, levels the processor lacks are skipped */
+		const SimdLevel previous = GetSimdLevel();
+		SetSimdLevel(testValue);
+		if (GetSimdLevel() == testValue)
+		{
+			CheckBatchFunctions<float>();
+			CheckBatchFunctions<double>();
+		}
+		SetSimdLevel(previous);
+	}
+}; // end of namespace winxframe
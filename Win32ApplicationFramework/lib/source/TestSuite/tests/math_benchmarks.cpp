@@ -0,0 +1,509 @@
+/*!
+lib\source\TestSuite\tests\math_benchmarks.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Math Benchmarks source file.
+*/
+
+#include <TestSuite/test_macros.hpp>
+#include <utils/big_int.hpp>
+#include <utils/binomial_table.hpp>
+#include <utils/math_batch.hpp>
+#include <utils/prime_sieve.hpp>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace winxframe
+{
+	using namespace math_utils;
+	using benchmark::DoNotOptimize;
+
+	BENCHMARK_CASE(bm_math_01, "Math Benchmarks", "Greatest Common Divisor")
+	{
+		static unsigned long long a = 1'234'567'890'123ULL, b = 987'654'321ULL;
+		DoNotOptimize(GCD(a, b));
+		++a;
+	}
+
+	BENCHMARK_CASE(bm_math_02, "Math Benchmarks", "Exponentiation")
+	{
+		static double x = 0.5;
+		DoNotOptimize(Exp(x));
+		x = x < 20.0 ? x + 0.25 : -20.0;
+	}
+
+	BENCHMARK_CASE(bm_math_03, "Math Benchmarks", "Natural Logarithm")
+	{
+		static double x = 0.5;
+		DoNotOptimize(Log(x));
+		x = x < 1e6 ? x * 1.5 : 1e-6;
+	}
+
+	BENCHMARK_CASE(bm_math_04, "Math Benchmarks", "Exponentiation")
+	{
+		/* Pow, integral exponent */
+		static double x = 0.5;
+		DoNotOptimize(Pow(x, 10));
+		x = x < 20.0 ? x + 0.25 : 0.5;
+	}
+
+	BENCHMARK_CASE(bm_math_05, "Math Benchmarks", "Exponentiation")
+	{
+		/* std::pow, integral exponent */
+		static double x = 0.5;
+		DoNotOptimize(std::pow(x, 10));
+		x = x < 20.0 ? x + 0.25 : 0.5;
+	}
+
+	BENCHMARK_CASE(bm_math_06, "Math Benchmarks", "Exponentiation")
+	{
+		/* Pow, real exponent */
+		static double x = 0.5;
+		DoNotOptimize(Pow(x, 2.5));
+		x = x < 1e6 ? x * 1.5 : 1e-6;
+	}
+
+	BENCHMARK_CASE(bm_math_07, "Math Benchmarks", "Exponentiation")
+	{
+		/* std::pow, real exponent */
+		static double x = 0.5;
+		DoNotOptimize(std::pow(x, 2.5));
+		x = x < 1e6 ? x * 1.5 : 1e-6;
+	}
+
+	namespace
+	{
+		/* 1024 particle-sized inputs in [0.01, 100) */
+		template <typename T>
+		const std::vector<T>& BatchInputs()
+		{
+			static const std::vector<T> inputs = []()
+				{
+					std::vector<T> values(1024);
+					for (std::size_t i = 0; i < values.size(); ++i)
+						values[i] = static_cast<T>(0.01 + 0.0975 * static_cast<double>(i));
+					return values;
+				}();
+			return inputs;
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_08, "Math Benchmarks", "Batch")
+	{
+		/* Exp over 1024 floats, batch */
+		static std::vector<float> out(1024);
+		Exp(BatchInputs<float>(), out);
+		DoNotOptimize(out.data());
+	}
+
+	BENCHMARK_CASE(bm_math_09, "Math Benchmarks", "Batch")
+	{
+		/* Exp over 1024 floats, scalar loop */
+		static std::vector<float> out(1024);
+		const std::vector<float>& x = BatchInputs<float>();
+		for (std::size_t i = 0; i < x.size(); ++i)
+			out[i] = Exp(x[i]);
+		DoNotOptimize(out.data());
+	}
+
+	BENCHMARK_CASE(bm_math_10, "Math Benchmarks", "Batch")
+	{
+		/* Pow(x, 2.5) over 1024 doubles, batch */
+		static std::vector<double> out(1024);
+		Pow(BatchInputs<double>(), 2.5, out);
+		DoNotOptimize(out.data());
+	}
+
+	BENCHMARK_CASE(bm_math_11, "Math Benchmarks", "Batch")
+	{
+		/* Pow(x, 2.5) over 1024 doubles, scalar loop */
+		static std::vector<double> out(1024);
+		const std::vector<double>& x = BatchInputs<double>();
+		for (std::size_t i = 0; i < x.size(); ++i)
+			out[i] = Pow(x[i], 2.5);
+		DoNotOptimize(out.data());
+	}
+
+	BENCHMARK_CASE(bm_math_12, "Math Benchmarks", "Modular Arithmetic")
+	{
+		/* ModBinomialSmall, 1000 Montgomery products per running product */
+		static unsigned long long n = 1'000'000;
+		DoNotOptimize(ModBinomialSmall(n, 1'000, 1'000'000'007ULL));
+		n = n < 2'000'000 ? n + 1 : 1'000'000;
+	}
+
+	BENCHMARK_CASE(bm_math_13, "Math Benchmarks", "Modular Arithmetic")
+	{
+		/* PowMod with a 63-bit prime */
+		static const ModContext context(9'223'372'036'854'775'783ULL);
+		static unsigned long long base = 2;
+		DoNotOptimize(context.PowMod(base, context.Modulus() - 2));
+		++base;
+	}
+
+	BENCHMARK_CASE(bm_math_14, "Math Benchmarks", "Modular Arithmetic")
+	{
+		/* BinomialTable, two Lucas digits of three table loads each, against the ModBinomial of bm_math_12 */
+		static const BinomialTable& table = BinomialTable::ForPrime(1'000'003ULL);
+		static unsigned long long n = 1'000'000'000'000ULL;
+		DoNotOptimize(table.Binomial(n, 1'000));
+		++n;
+	}
+
+	namespace
+	{
+		/* The previous O(n) Fibonacci loop, as the baseline of the fast doubling benchmarks; add gives F(i + 1) from F(i - 1) and F(i) */
+		template <typename T, typename Add>
+		T FibonacciLoop(unsigned long long n, Add add)
+		{
+			T a = 0, b = 1;
+			if (n == 0) return a;
+			for (unsigned long long i = 2; i <= n; ++i)
+			{
+				T next = add(a, b);
+				a = std::move(b);
+				b = std::move(next);
+			}
+			return b;
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_15, "Math Benchmarks", "Fibonacci")
+	{
+		/* Fibonacci, fast doubling */
+		static int n = 50;
+		DoNotOptimize(Fibonacci(n));
+		n = n < 93 ? n + 1 : 50;
+	}
+
+	BENCHMARK_CASE(bm_math_16, "Math Benchmarks", "Fibonacci")
+	{
+		/* loop */
+		static int n = 50;
+		DoNotOptimize(FibonacciLoop<unsigned long long>(n, [](unsigned long long a, unsigned long long b) { return a + b; }));
+		n = n < 93 ? n + 1 : 50;
+	}
+
+	BENCHMARK_CASE(bm_math_17, "Math Benchmarks", "Fibonacci")
+	{
+		/* Fibonacci(n, m), n = 10^6 */
+		static unsigned long long n = 1'000'000;
+		DoNotOptimize(Fibonacci(n, 1'000'000'007ULL));
+		++n;
+	}
+
+	BENCHMARK_CASE(bm_math_18, "Math Benchmarks", "Fibonacci")
+	{
+		/* loop mod m, n = 10^6 */
+		static unsigned long long n = 1'000'000;
+		DoNotOptimize(FibonacciLoop<unsigned long long>(n, [](unsigned long long a, unsigned long long b) { return (a + b) % 1'000'000'007ULL; }));
+		++n;
+	}
+
+	BENCHMARK_CASE(bm_math_19, "Math Benchmarks", "Fibonacci")
+	{
+		/* Fibonacci<BigInt>, F(20000) has 4180 digits */
+		DoNotOptimize(Fibonacci<BigInt>(20'000));
+	}
+
+	BENCHMARK_CASE(bm_math_20, "Math Benchmarks", "Fibonacci")
+	{
+		/* BigInt loop */
+		DoNotOptimize(FibonacciLoop<BigInt>(20'000, [](const BigInt& a, const BigInt& b) { return a + b; }));
+	}
+
+	namespace
+	{
+		/* Two operands of about 1020 limbs, F(94000) and F(94100) */
+		const std::pair<BigInt, BigInt>& ProductOperands()
+		{
+			static const std::pair<BigInt, BigInt> operands = { Fibonacci<BigInt>(94'000), Fibonacci<BigInt>(94'100) };
+			return operands;
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_21, "Math Benchmarks", "Big Integer")
+	{
+		/* BigInt product, 1020 x 1020 limbs (Karatsuba) */
+		const auto& [a, b] = ProductOperands();
+		DoNotOptimize(a * b);
+	}
+
+	BENCHMARK_CASE(bm_math_22, "Math Benchmarks", "Big Integer")
+	{
+		/* schoolbook product of the same limbs */
+		const auto& [a, b] = ProductOperands();
+		static std::vector<std::uint64_t> product(a.LimbCount() + b.LimbCount());
+		detail::MulSchoolbook(product.data(), a.Limbs().data(), a.LimbCount(), b.Limbs().data(), b.LimbCount());
+		DoNotOptimize(product);
+	}
+
+	BENCHMARK_CASE(bm_math_23, "Math Benchmarks", "Big Integer")
+	{
+		/* ToString, 20899 digits */
+		static const BigInt value = Fibonacci<BigInt>(100'000);
+		DoNotOptimize(value.ToString());
+	}
+
+	BENCHMARK_CASE(bm_math_24, "Math Benchmarks", "Big Integer")
+	{
+		/* Factorial<BigInt>(5000), product tree */
+		DoNotOptimize(Factorial<BigInt>(5'000));
+	}
+
+	namespace
+	{
+		/* The previous Euclidean GCD and LCM, as the baseline of the binary GCD benchmarks */
+		template <std::integral T>
+		T EuclidGCD(T a, T b)
+		{
+			while (b != 0) b = Exchange(a, b) % b;
+			return a;
+		}
+
+		template <std::integral T>
+		T EuclidLCM(T a, T b)
+		{
+			if (a == 0 || b == 0) return 0;
+			const T g = EuclidGCD(a, b);
+			assert(a / g <= std::numeric_limits<T>::max() / b && "EuclidLCM: overflow");
+			return (a / g) * b;
+		}
+
+		/* 4096 random pairs, the second value shifted right by a random amount so that the sizes differ */
+		template <typename T>
+		const std::vector<std::pair<T, T>>& RandomPairs()
+		{
+			static const std::vector<std::pair<T, T>> pairs = []()
+				{
+					std::mt19937_64 engine(20261016);
+					std::vector<std::pair<T, T>> result(4'096);
+					for (auto& [a, b] : result)
+					{
+						a = static_cast<T>(engine()) | 1;
+						b = static_cast<T>(engine() >> (engine() % 8)) | 1;
+					}
+					return result;
+				}();
+			return pairs;
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_25, "Math Benchmarks", "Greatest Common Divisor")
+	{
+		/* binary GCD, random 32-bit values */
+		static std::size_t i = 0;
+		const auto& [a, b] = RandomPairs<std::uint32_t>()[i++ & 4'095];
+		DoNotOptimize(GCD(a, b));
+	}
+
+	BENCHMARK_CASE(bm_math_26, "Math Benchmarks", "Greatest Common Divisor")
+	{
+		/* Euclidean GCD, random 32-bit values */
+		static std::size_t i = 0;
+		const auto& [a, b] = RandomPairs<std::uint32_t>()[i++ & 4'095];
+		DoNotOptimize(EuclidGCD(a, b));
+	}
+
+	BENCHMARK_CASE(bm_math_27, "Math Benchmarks", "Greatest Common Divisor")
+	{
+		/* binary GCD, random 64-bit values */
+		static std::size_t i = 0;
+		const auto& [a, b] = RandomPairs<std::uint64_t>()[i++ & 4'095];
+		DoNotOptimize(GCD(a, b));
+	}
+
+	BENCHMARK_CASE(bm_math_28, "Math Benchmarks", "Greatest Common Divisor")
+	{
+		/* Euclidean GCD, random 64-bit values */
+		static std::size_t i = 0;
+		const auto& [a, b] = RandomPairs<std::uint64_t>()[i++ & 4'095];
+		DoNotOptimize(EuclidGCD(a, b));
+	}
+
+	BENCHMARK_CASE(bm_math_29, "Math Benchmarks", "Least Common Multiple")
+	{
+		/* LCM, random 32-bit values in 64-bit arithmetic */
+		static std::size_t i = 0;
+		const auto& [a, b] = RandomPairs<std::uint32_t>()[i++ & 4'095];
+		DoNotOptimize(LCM<std::uint64_t>(a, b));
+	}
+
+	BENCHMARK_CASE(bm_math_30, "Math Benchmarks", "Least Common Multiple")
+	{
+		/* Euclidean LCM with the division overflow check */
+		static std::size_t i = 0;
+		const auto& [a, b] = RandomPairs<std::uint32_t>()[i++ & 4'095];
+		DoNotOptimize(EuclidLCM<std::uint64_t>(a, b));
+	}
+
+	BENCHMARK_CASE(bm_math_31, "Math Benchmarks", "Greatest Common Divisor")
+	{
+		/* GCD of a span of 4096 random 64-bit values with a common factor of 6 */
+		static const std::vector<std::uint64_t> values = []()
+			{
+				std::vector<std::uint64_t> result;
+				for (const auto& [a, b] : RandomPairs<std::uint32_t>())
+					result.push_back(static_cast<std::uint64_t>(a) * 6);
+				return result;
+			}();
+		DoNotOptimize(GCD(std::span(values)));
+	}
+
+	BENCHMARK_CASE(bm_math_32, "Math Benchmarks", "Prime Sieve")
+	{
+		/* primes in [10^12, 10^12 + 10^7), every hardware thread */
+		DoNotOptimize(CountPrimes(1'000'000'000'000ULL, 1'000'010'000'000ULL));
+	}
+
+	BENCHMARK_CASE(bm_math_33, "Math Benchmarks", "Prime Sieve")
+	{
+		/* primes in [10^12, 10^12 + 10^7), one thread */
+		DoNotOptimize(CountPrimes(1'000'000'000'000ULL, 1'000'010'000'000ULL, 1));
+	}
+
+	namespace
+	{
+		/* Trial division by the odd numbers up to sqrt(n) */
+		bool IsPrimeByDivision(std::uint64_t n)
+		{
+			if (n < 2 || n % 2 == 0) return n == 2;
+			for (std::uint64_t d = 3; d * d <= n; d += 2)
+			{
+				if (n % d == 0) return false;
+			}
+			return true;
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_34, "Math Benchmarks", "Primality")
+	{
+		/* Miller-Rabin, random odd 64-bit values */
+		static std::size_t i = 0;
+		DoNotOptimize(IsPrime(RandomPairs<std::uint64_t>()[i++ & 4'095].first));
+	}
+
+	BENCHMARK_CASE(bm_math_35, "Math Benchmarks", "Primality")
+	{
+		/* Miller-Rabin, random odd 32-bit values */
+		static std::size_t i = 0;
+		DoNotOptimize(IsPrime(RandomPairs<std::uint32_t>()[i++ & 4'095].first));
+	}
+
+	BENCHMARK_CASE(bm_math_36, "Math Benchmarks", "Primality")
+	{
+		/* trial division, random odd 32-bit values */
+		static std::size_t i = 0;
+		DoNotOptimize(IsPrimeByDivision(RandomPairs<std::uint32_t>()[i++ & 4'095].first));
+	}
+
+	namespace
+	{
+		/* 64 semiprimes p * q near 2^62, p and q random primes near 2^31 */
+		const std::vector<std::uint64_t>& Semiprimes()
+		{
+			static const std::vector<std::uint64_t> values = []()
+				{
+					std::mt19937_64 engine(20261016);
+					const auto randomPrime = [&engine]()
+						{
+							std::uint64_t p = 2'000'000'000ULL + engine() % 147'000'000ULL;
+							while (!IsPrime(p)) ++p;
+							return p;
+						};
+					std::vector<std::uint64_t> result(64);
+					for (std::uint64_t& value : result)
+						value = randomPrime() * randomPrime();
+					return result;
+				}();
+			return values;
+		}
+
+		/* Pollard rho with Floyd's cycle detection and a GCD per step, as the baseline of the Brent rho benchmarks */
+		std::uint64_t FloydRho(std::uint64_t n)
+		{
+			const ModContext context(n);
+			for (std::uint64_t c = 1;; ++c)
+			{
+				const auto step = [&context, c](std::uint64_t x) { return context.AddMod(context.MulMod(x, x), c); };
+				std::uint64_t x = 2, y = 2, divisor = 1;
+				while (divisor == 1)
+				{
+					x = step(x);
+					y = step(step(y));
+					divisor = GCD(x > y ? x - y : y - x, n);
+				}
+				if (divisor != n) return divisor;
+			}
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_37, "Math Benchmarks", "Factorization")
+	{
+		/* Factorize, semiprimes of two 31-bit primes */
+		static std::size_t i = 0;
+		DoNotOptimize(Factorize(Semiprimes()[i++ & 63]));
+	}
+
+	BENCHMARK_CASE(bm_math_38, "Math Benchmarks", "Factorization")
+	{
+		/* Floyd rho with a GCD per step, semiprimes of two 31-bit primes */
+		static std::size_t i = 0;
+		DoNotOptimize(FloydRho(Semiprimes()[i++ & 63]));
+	}
+
+	BENCHMARK_CASE(bm_math_39, "Math Benchmarks", "Factorization")
+	{
+		/* Factorize, random odd 64-bit values */
+		static std::size_t i = 0;
+		DoNotOptimize(Factorize(RandomPairs<std::uint64_t>()[i++ & 4'095].first));
+	}
+
+	BENCHMARK_CASE(bm_math_40, "Math Benchmarks", "Big Integer")
+	{
+		/* ToString, 83595 digits, four times bm_math_23 (quadratic conversion would take 16 times as long) */
+		static const BigInt value = Fibonacci<BigInt>(400'000);
+		DoNotOptimize(value.ToString());
+	}
+
+	namespace
+	{
+		/* F(2n + 1) and F(n), a dividend of twice the limbs of its divisor (F(n) has about 0.0108 * n limbs) */
+		template <unsigned long long N>
+		const std::pair<BigInt, BigInt>& DivisionOperands()
+		{
+			static const std::pair<BigInt, BigInt> operands = { Fibonacci<BigInt>(2 * N + 1), Fibonacci<BigInt>(N) };
+			return operands;
+		}
+	}
+
+	BENCHMARK_CASE(bm_math_41, "Math Benchmarks", "Big Integer")
+	{
+		/* DivMod, 2040 by 1020 limbs (Burnikel-Ziegler) */
+		const auto& [a, b] = DivisionOperands<94'000>();
+		BigInt quotient, remainder;
+		BigInt::DivMod(a, b, quotient, remainder);
+		DoNotOptimize(remainder);
+	}
+
+	BENCHMARK_CASE(bm_math_42, "Math Benchmarks", "Big Integer")
+	{
+		/* DivMod, 8160 by 4080 limbs, four times bm_math_41 */
+		const auto& [a, b] = DivisionOperands<376'000>();
+		BigInt quotient, remainder;
+		BigInt::DivMod(a, b, quotient, remainder);
+		DoNotOptimize(remainder);
+	}
+
+	BENCHMARK_CASE(bm_math_43, "Math Benchmarks", "Big Integer")
+	{
+		/* algorithm D on the limbs of bm_math_42 */
+		const auto& [a, b] = DivisionOperands<376'000>();
+		static std::vector<std::uint64_t> quotient(a.LimbCount() - b.LimbCount() + 1), remainder(b.LimbCount());
+		detail::DivModLimbs(a.Limbs().data(), a.LimbCount(), b.Limbs().data(), b.LimbCount(), quotient.data(), remainder.data());
+		DoNotOptimize(remainder);
+	}
+}; // end of namespace winxframe
@@ -1,7 +1,7 @@
 /*!
 lib\source\TestSuite\tests\math_tests.cpp
 Created: October 21, 2025
-Updated: October 30, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Math Tests source file.
@@ -9,11 +9,50 @@ Math Tests source file.
 
 #include <TestSuite/test_macros.hpp>
 #include <utils/math_utils.hpp>
+#include <utils/big_int.hpp>
+#include <utils/binomial_table.hpp>
+#include <utils/prime_sieve.hpp>
+#include <atomic>
+#include <numeric>
+#include <random>
+#include <vector>
 
 namespace winxframe
 {
 	using namespace math_utils;
 
+	namespace
+	{
+		/* Pow(base, exponent) resolves to an overload that is not deleted */
+		template <typename T, typename U>
+		concept PowAccepts = requires(T base, U exponent) { Pow(base, exponent); };
+
+		/* Primes() and CountPrimes() on [lo, hi) against IsPrime() on every value */
+		bool SieveMatchesIsPrime(std::uint64_t lo, std::uint64_t hi, std::size_t threadCount)
+		{
+			std::vector<std::uint64_t> expected;
+			for (std::uint64_t n = lo; n < hi; ++n)
+			{
+				if (IsPrime(n)) expected.push_back(n);
+			}
+			return Primes(lo, hi, threadCount) == expected && CountPrimes(lo, hi, threadCount) == expected.size();
+		}
+
+		/* pi(hi) from ForEachPrime(), or 0 when the primes do not arrive in increasing order */
+		std::uint64_t CountIncreasingPrimes(std::uint64_t hi, std::size_t threadCount)
+		{
+			std::uint64_t previous = 0, count = 0;
+			bool isIncreasing = true;
+			ForEachPrime(0, hi, [&](std::uint64_t p)
+				{
+					isIncreasing = isIncreasing && p > previous;
+					previous = p;
+					++count;
+				}, threadCount);
+			return isIncreasing ? count : 0;
+		}
+	}
+
 	TEST_CASE(ut_math_01, "Math Tests", "Simple Calculations")
 	{
 		CHECK(1 + 1 == 2);
@@ -280,11 +319,38 @@ namespace winxframe
 		static_assert(Pow(0, 0) == 1);
 		static_assert(Pow(2, 0) == 1);
 		static_assert(Pow(-2, 3) == -8);
-		static_assert(static_cast<int>(Pow(2.0, 3)) == 8);
+		static_assert(Pow(2.0, 3) == 8.0);
 		static_assert(Pow(-2, 4) == 16);
-		static_assert(static_cast<int>(Pow(2.0f, 4)) == 16);
+		static_assert(Pow(2.0f, 4) == 16.0f);
 		static_assert(Pow(5LL, 3) == 125LL);
 		static_assert(Pow(2ULL, 10) == 1024ULL);
+		static_assert(Pow(2.0, 10) == 1024.0);
+		static_assert(Pow(-3.0, 5) == -243.0);
+		static_assert(Pow(2.0, -3) == 0.125);
+		static_assert(Pow(10.0, 22) == 1e22);
+		CHECK(Pow(2.0, -1074) == std::numeric_limits<double>::denorm_min());
+		CHECK(Pow(0.0, -1) == std::numeric_limits<double>::infinity());
+		CHECK(Pow(-0.0, -1) == -std::numeric_limits<double>::infinity());
+		CHECK(Pow(-0.0, 3) == 0.0 && std::signbit(Pow(-0.0, 3)));
+		CHECK(Pow(-std::numeric_limits<double>::infinity(), -3) == 0.0 && std::signbit(Pow(-std::numeric_limits<double>::infinity(), -3)));
+		// correctly rounded from 400-bit arithmetic, glibc powl is off by several ULP here
+		CHECK(Pow(3.9523658653363283, 512) == 0x1.1c3789c833c9cp+1015);
+		CHECK(Pow(3.9523658653363283, -512) == 0x1.cd2b393f06188p-1016);
+		CHECK(Pow(10.0, 309) == std::numeric_limits<double>::infinity());
+
+		// integral exponents of any width, mixed floating types are rejected instead of truncating the exponent to int
+		static_assert(Pow(2.0, 10LL) == 1024.0 && Pow(2.0f, 10u) == 1024.0f && Pow(2ULL, 10u) == 1024ULL);
+		static_assert(PowAccepts<double, double> && PowAccepts<float, int> && PowAccepts<double, unsigned long long>);
+		static_assert(!PowAccepts<float, double> && !PowAccepts<double, float> && !PowAccepts<double, long double>);
+		CHECK(Pow(-1.0, 3'000'000'001LL) == -1.0);
+		CHECK(Pow(-0.0, 3'000'000'001LL) == 0.0 && std::signbit(Pow(-0.0, 3'000'000'001LL)));
+		CHECK(Pow(-2.0, 5'000'000'000LL) == std::numeric_limits<double>::infinity());
+		CHECK(Abs(Pow(1.0 + 0x1p-52, 1LL << 40) - std::pow(1.0 + 0x1p-52, 0x1p40)) <= 0x1p-52);
+		for (int e = -30; e <= 30; ++e)
+		{
+			CHECK(Pow(-1.5, e) == std::pow(-1.5, e));
+			CHECK(Pow(3.0, e) == std::pow(3.0, e));
+		}
 		for (long long b = -20; b <= 20; ++b)
 		{
 			for (int e = 0; e <= 14; ++e)
@@ -372,4 +438,364 @@ namespace winxframe
 			CHECK(ss >= 0);
 		}
 	}
-}; // end of namespace winxframe
\ No newline at end of file
+	TEST_CASE_TEMPLATE(ut_math_20, "Math Tests", "Absolute Values", signed char, short, int, long, long long, float, double, long double)
+	{
+		/* Abs */
+		static_assert(std::is_same_v<decltype(Abs(TestType{})), TestType>);
+		static_assert(Abs(static_cast<TestType>(-5)) == static_cast<TestType>(5));
+		CHECK(Abs(TestType{}) == TestType{});
+		CHECK(Abs(static_cast<TestType>(1)) == static_cast<TestType>(1));
+		CHECK(Abs(static_cast<TestType>(-1)) == static_cast<TestType>(1));
+		CHECK(Abs(std::numeric_limits<TestType>::max()) == std::numeric_limits<TestType>::max());
+		if constexpr (std::is_integral_v<TestType>)
+			CHECK(Abs(std::numeric_limits<TestType>::min()) == std::numeric_limits<TestType>::max());
+		else
+			CHECK(Abs(-std::numeric_limits<TestType>::infinity()) == std::numeric_limits<TestType>::infinity());
+	}
+
+	TEST_CASE_TEMPLATE(ut_math_21, "Math Tests", "Modulus", signed char, unsigned char, short, unsigned short, int, unsigned, long long, unsigned long long)
+	{
+		/* Mod, FloorDiv, GCD */
+		static_assert(std::is_same_v<decltype(Mod(TestType{}, TestType{ 1 })), TestType>);
+		for (int a = 0; a <= 60; ++a)
+		{
+			for (int b = 1; b <= 12; ++b)
+			{
+				const TestType x = static_cast<TestType>(a), y = static_cast<TestType>(b);
+				CHECK(Mod(x, y) == static_cast<TestType>(a % b));
+				CHECK(FloorDiv(x, y) == static_cast<TestType>(a / b));
+				CHECK(GCD(x, y) == static_cast<TestType>(std::gcd(a, b)));
+			}
+		}
+		if constexpr (std::is_signed_v<TestType>)
+		{
+			CHECK(Mod(static_cast<TestType>(-5), static_cast<TestType>(3)) == static_cast<TestType>(1));
+			CHECK(FloorDiv(static_cast<TestType>(-5), static_cast<TestType>(3)) == static_cast<TestType>(-2));
+		}
+	}
+
+	TEST_CASE_VALUES(ut_math_22, "Math Tests", "Natural Logarithm", double, test_params::Range(0.0, 20.0, 2.5))
+	{
+		/* Log(Exp(x)) round trip */
+		CHECK(Abs(Log(Exp(testValue)) - testValue) < 1e-10);
+		CHECK(Abs(Exp(testValue) - std::exp(testValue)) <= 1e-12 * std::exp(testValue));
+	}
+
+	TEST_CASE_VALUES(ut_math_23, "Math Tests", "Greatest Common Divisor", long long, { 1LL, 12LL, 97LL, 1'000'000'007LL, 9'223'372'036'854'775'807LL })
+	{
+		/* GCD, LCM */
+		CHECK_EQUAL(GCD(testValue, testValue), testValue);
+		CHECK_EQUAL(GCD(testValue, 0LL), testValue);
+		CHECK_EQUAL(GCD(-testValue, testValue), testValue);
+		CHECK_EQUAL(LCM(testValue, 1LL), testValue);
+	}
+
+	TEST_CASE(ut_math_24, "Math Tests", "Exponentiation")
+	{
+		/* Pow, real exponent */
+		constexpr double infinity = std::numeric_limits<double>::infinity();
+		static_assert(Pow(2.0, 10.0) == 1024.0);
+		static_assert(Pow(4.0, 0.5) == 2.0);
+		static_assert(Pow(-2.0, 3.0) == -8.0);
+		static_assert(Abs(Pow(2.0f, 0.5f) - 1.4142135f) < 1e-6f);
+		CHECK(Pow(-8.0, 1.0 / 3.0) != Pow(-8.0, 1.0 / 3.0));
+		CHECK(Pow(std::numeric_limits<double>::quiet_NaN(), 0.0) == 1.0);
+		CHECK(Pow(1.0, std::numeric_limits<double>::quiet_NaN()) == 1.0);
+		CHECK(Pow(-1.0, infinity) == 1.0);
+		CHECK(Pow(0.5, infinity) == 0.0);
+		CHECK(Pow(0.5, -infinity) == infinity);
+		CHECK(Pow(-0.0, -3.0) == -infinity);
+		CHECK(Pow(-infinity, 3.0) == -infinity);
+		CHECK(Pow(-infinity, -2.0) == 0.0);
+		CHECK(Pow(10.0, 400.0) == infinity);
+		CHECK(Pow(10.0, -400.0) == 0.0);
+		CHECK(Pow(-0.0, 1.0) == 0.0 && std::signbit(Pow(-0.0, 1.0)));
+		CHECK(Pow(-0.0, 3.0) == 0.0 && std::signbit(Pow(-0.0, 3.0)));
+		CHECK(Pow(-infinity, -1.0) == 0.0 && std::signbit(Pow(-infinity, -1.0)));
+		CHECK(Pow(-infinity, -3.0) == 0.0 && std::signbit(Pow(-infinity, -3.0)));
+		CHECK(Pow(-0.0, 2.0) == 0.0 && !std::signbit(Pow(-0.0, 2.0)));
+		CHECK(Pow(-0.0, 0.5) == 0.0 && !std::signbit(Pow(-0.0, 0.5)));
+		CHECK(Pow(-infinity, 0.5) == infinity);
+		CHECK(Pow(-infinity, -0.5) == 0.0 && !std::signbit(Pow(-infinity, -0.5)));
+		CHECK(Pow(-infinity, 101.0) == -infinity);
+		CHECK(Pow(-0.0, -101.0) == -infinity);
+		for (double y = -40.0; y <= 40.0; y += 0.375)
+		{
+			CHECK(Abs(Pow(1.7, y) - std::pow(1.7, y)) <= 2.3e-16 * std::pow(1.7, y));
+			CHECK(Abs(Pow(0.3, y) - std::pow(0.3, y)) <= 2.3e-16 * std::pow(0.3, y));
+		}
+	}
+
+	TEST_CASE(ut_math_25, "Math Tests", "Modular Arithmetic")
+	{
+		/* ModContext, 63 and 64-bit moduli whose products overflow unsigned long long */
+		constexpr unsigned long long prime63 = 9'223'372'036'854'775'783ULL;		// 2^63 - 25
+		constexpr unsigned long long prime64 = 18'446'744'073'709'551'557ULL;		// 2^64 - 59
+		constexpr unsigned long long a = 123'456'789'123'456'789ULL, b = 987'654'321'987'654'321ULL;
+		static_assert(ModContext(prime63).MulMod(a, b) == 5'476'743'077'473'605'886ULL);
+		static_assert(ModContext(prime64).PowMod(3, prime64 - 1) == 1);
+		const ModContext context63(prime63), context64(prime64), contextEven(18'446'744'073'709'551'614ULL);
+		CHECK(context64.MulMod(a, b) == 14'759'604'945'044'498'069ULL);
+		CHECK(ModContext(1ULL << 63).MulMod(a, b) == 5'146'244'017'939'625'861ULL);
+		CHECK(contextEven.MulMod(a, b) == 14'382'836'017'175'760'869ULL);
+		CHECK(context63.PowMod(3, prime63 - 2) == 6'148'914'691'236'517'189ULL);
+		CHECK(context64.PowMod(a, 1'000'000'007ULL) == 5'558'978'824'705'800'808ULL);
+		CHECK(contextEven.PowMod(3, 1'000'000'000'000'000'000ULL) == 10'073'217'964'033'678'647ULL);
+		CHECK(context64.InvMod(a) == 122'735'875'066'996'616ULL);
+		CHECK(context63.InvMod(a) == 1'301'361'235'397'016'679ULL);
+		CHECK(context63.PowMod(a, 0) == 1);
+		CHECK(context64.FromResidue(context64.PowResidue(context64.ToResidue(a), 1'000'000'007ULL)) == 5'558'978'824'705'800'808ULL);
+		CHECK(contextEven.PowResidue(3, 1'000'000'000'000'000'000ULL) == 10'073'217'964'033'678'647ULL);
+		CHECK(context63.AddMod(prime63 - 1, 5) == 4);
+		CHECK(context63.SubMod(3, 5) == prime63 - 2);
+		for (unsigned long long x = 1; x < 2000; x += 37)
+		{
+			CHECK(context64.FromResidue(context64.ToResidue(x * 1'000'003ULL)) == x * 1'000'003ULL);
+			CHECK(context64.MulMod(x, context64.InvMod(x)) == 1);
+			if (GCD<unsigned long long>(2 * x + 1, contextEven.Modulus()) == 1)
+				CHECK(contextEven.MulMod(2 * x + 1, contextEven.InvMod(2 * x + 1)) == 1);
+		}
+
+		/* ModInverse, ModBinomialSmall, ModBinomial beyond 32-bit moduli */
+		CHECK(ModInverse(-3, 11) == 7);
+		CHECK(ModInverse(a, prime64) == 122'735'875'066'996'616ULL);
+		CHECK(ModBinomialSmall(4'294'967'306ULL, 20'000ULL, 4'294'967'311ULL) == 2'248'738'221ULL);
+		CHECK(ModBinomialSmall(prime63 - 1'000, 3'000ULL, prime63) == 1'114'160'786'383'967'282ULL);
+		CHECK(ModBinomial(100, 50, 2'305'843'009'213'693'951ULL) == 1'184'508'377'594'806'080ULL);
+		CHECK(ModBinomial(1'000'000, 1'000, prime63) == 5'095'833'790'884'734'207ULL);
+		CHECK(ModBinomial(987'654'321'987'654'321ULL, 123'456'789ULL, 10'007ULL) == 4'846ULL);
+		CHECK(ModBinomial(1'000, 500, 1'000'000'007ULL) == 159'835'829ULL);
+	}
+
+	TEST_CASE(ut_math_26, "Math Tests", "Modulus Binomial")
+	{
+		/* BinomialTable against ModBinomial, including digits beyond the table capacity */
+		for (const unsigned long long prime : { 2ULL, 3ULL, 7ULL, 10'007ULL, 1'000'003ULL, 1'000'000'007ULL, 9'223'372'036'854'775'783ULL })
+		{
+			const BinomialTable table(prime, 5'000);
+			CHECK(table.Prime() == prime);
+			CHECK(table.Size() == Min(prime, 5'000ULL));
+			unsigned long long n = 1;
+			for (int i = 0; i < 300; ++i)
+			{
+				n = n * 6'364'136'223'846'793'005ULL + 1'442'695'040'888'963'407ULL;
+				const unsigned long long small = (n >> 33) % 12'000, large = n >> 4;
+				CHECK_EQUAL(table.Binomial(small, small / 3), ModBinomial(small, small / 3, prime));
+				// many digit queries, only where the reference stays cheap
+				if (prime < 20'000)
+					CHECK_EQUAL(table.Binomial(large, large / 7), ModBinomial(large, large / 7, prime));
+			}
+			CHECK(table.Binomial(5, 6) == 0);
+			CHECK(table.Binomial(0, 0) == 1);
+		}
+
+		/* batch queries, shared tables */
+		const std::vector<unsigned long long> n = { 0, 5, 10, 66, 1'000, 999'999, 123'456'789'123ULL, 7 };
+		const std::vector<unsigned long long> k = { 0, 2, 5, 33, 500, 499'999, 1'234'567ULL, 9 };
+		std::vector<unsigned long long> out(n.size());
+		const BinomialTable& shared = BinomialTable::ForPrime(1'000'000'007ULL);
+		CHECK(&shared == &BinomialTable::ForPrime(1'000'000'007ULL));
+		shared.Binomial(n, k, out);
+		for (std::size_t i = 0; i < n.size(); ++i)
+			CHECK_EQUAL(out[i], ModBinomial(n[i], k[i], 1'000'000'007ULL));
+		CHECK(out[3] == 480'267'059ULL);
+		CHECK(out[4] == 159'835'829ULL);
+	}
+
+	TEST_CASE_STRESS(ut_math_27, 8, 2'000, "Math Tests", "Modulus Binomial")
+	{
+		/* concurrent first queries build each table once */
+		constexpr unsigned long long primes[] = { 1'000'003ULL, 998'244'353ULL, 1'000'000'007ULL };
+		static std::atomic<unsigned long long> counter{ 0 };
+		const unsigned long long i = counter.fetch_add(1, std::memory_order_relaxed);
+		const unsigned long long prime = primes[(i + threadIndex) % 3];
+		const unsigned long long n = (i * 7'919) % 5'000, k = (i * 104'729) % (n + 1);
+		CHECK(BinomialTable::ForPrime(prime).Binomial(n, k) == ModBinomial(n, k, prime));
+	}
+
+	TEST_CASE(ut_math_28, "Math Tests", "Fibonacci")
+	{
+		/* Fibonacci<T>, the largest F(n) of each integral type */
+		static_assert(detail::FibonacciLimit<unsigned char>() == 13);
+		static_assert(detail::FibonacciLimit<int>() == 46);
+		static_assert(detail::FibonacciLimit<unsigned long long>() == 93);
+		static_assert(Fibonacci<unsigned char>(13) == 233);
+		static_assert(Fibonacci<int>(46) == 1'836'311'903);
+
+		/* Fibonacci(n, m) */
+		static_assert(Fibonacci(93, 1'000) == Fibonacci(93) % 1'000);
+		for (const unsigned long long m : { 1ULL, 2ULL, 10ULL, 1'000'000'007ULL, 9'223'372'036'854'775'808ULL, 18'446'744'073'709'551'557ULL })
+		{
+			for (int n = 0; n <= 93; ++n)
+				CHECK_EQUAL(Fibonacci(n, m), Fibonacci(n) % m);
+		}
+		CHECK(Fibonacci(1'000'000'000'000'000'000ULL, 1'000'000'007ULL) == 209'783'453ULL);
+		CHECK(Fibonacci(12'345'678'901'234'567ULL, 998'244'353ULL) == 35'036'226ULL);
+		CHECK(Fibonacci(~0ULL, 18'446'744'073'709'551'557ULL) == 18'446'743'708'274'255'395ULL);
+		CHECK(Fibonacci(~0ULL, 9'223'372'036'854'775'808ULL) == 800'812'746'651'928'290ULL);
+		for (unsigned long long n = 1; n < 1'000'000'000'000ULL; n = n * 7 + 3)
+			CHECK(Fibonacci(n, 10) == Fibonacci(n % 60, 10));      // Pisano period 60
+
+		/* Fibonacci<BigInt> */
+		for (int n = 0; n <= 93; ++n)
+			CHECK(Fibonacci<BigInt>(n) == BigInt(Fibonacci(n)));
+		CHECK(Fibonacci<BigInt>(1'000).ToString() == "43466557686937456435688527675040625802564660517371780402481729089536555417949051890403879840079255169295922593080322634775209689623239873322471161642996440906533187938298969649928516003704476137795166849228875");
+		const std::string f10000 = Fibonacci<BigInt>(10'000).ToString();
+		CHECK(f10000.size() == 2'090);
+		CHECK(f10000.substr(0, 20) == "33644764876431783266");
+		CHECK(f10000.substr(2'070) == "66073310059947366875");
+
+		/* BigInt signs, carries and ordering */
+		const BigInt max64 = ~0ULL;
+		CHECK((max64 * max64).ToString() == "340282366920938463426481119284349108225");
+		CHECK((-(max64 + 1) * 3 + 5).ToString() == "-55340232221128654843");
+		CHECK(BigInt(-5) + 3 == BigInt(-2));
+		CHECK((BigInt(7) - 7).ToString() == "0");
+		CHECK(!(-BigInt(0)).IsNegative());
+		CHECK(BigInt(std::numeric_limits<long long>::min()).ToString() == "-9223372036854775808");
+		CHECK(BigInt(-3) < BigInt(2));
+		CHECK(-(max64 * max64) < -max64);
+		CHECK((max64 + 1).BitWidth() == 65);
+	}
+
+	TEST_CASE(ut_math_29, "Math Tests", "Greatest Common Divisor")
+	{
+		/* binary GCD and LCM against std::gcd and std::lcm on random 32 and 64-bit values with shared factors of two */
+		static_assert(GCD(48u, 180u) == 12u);
+		static_assert(GCD(std::numeric_limits<long long>::min() + 1, 0LL) == std::numeric_limits<long long>::max());
+		static_assert(LCM(65'536u, 65'535u) == 4'294'901'760u);
+		std::mt19937_64 engine(20261016);
+		for (int i = 0; i < 20'000; ++i)
+		{
+			const unsigned shift = static_cast<unsigned>(engine() % 12);
+			const std::uint32_t a32 = static_cast<std::uint32_t>(engine()) << shift, b32 = static_cast<std::uint32_t>(engine() >> (engine() % 32)) << shift;
+			CHECK_EQUAL(GCD(a32, b32), std::gcd(a32, b32));
+			const std::int64_t a64 = static_cast<std::int64_t>(engine() >> 1) >> (engine() % 40), b64 = -(static_cast<std::int64_t>(engine() >> 2) << (engine() % 3));
+			CHECK_EQUAL(GCD(a64, b64), std::gcd(a64, b64));
+			const unsigned long long c = engine() % 1'000'000'000ULL, d = engine() % 1'000'000'000ULL;
+			CHECK_EQUAL(GCD(c * 6, d * 6), std::gcd(c * 6, d * 6));
+			CHECK_EQUAL(LCM(c, d), std::lcm(c, d));
+			CHECK_EQUAL(LCM(-static_cast<long long>(c), static_cast<long long>(d)), std::lcm(-static_cast<long long>(c), static_cast<long long>(d)));
+		}
+		CHECK(GCD(std::numeric_limits<unsigned long long>::max(), std::numeric_limits<unsigned long long>::max() - 2) == 1);
+		CHECK(LCM(std::numeric_limits<unsigned long long>::max(), 1ULL) == std::numeric_limits<unsigned long long>::max());
+		CHECK(LCM<std::int8_t>(-8, 12) == 24);
+
+		/* GCD and LCM of spans */
+		const std::vector<int> multiplesOf6 = { 0, 36, -54, 12'000, 18 };
+		static_assert(GCD(std::span<const int>()) == 0);
+		static_assert(LCM(std::span<const int>()) == 1);
+		CHECK(GCD(std::span(multiplesOf6)) == 6);
+		CHECK(LCM(std::span(multiplesOf6)) == 0);
+		const std::vector<unsigned long long> divisors = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20 };
+		CHECK(LCM(std::span(divisors)) == 232'792'560ULL);
+		CHECK(GCD(std::span(divisors)) == 1);
+	}
+
+	TEST_CASE(ut_math_30, "Math Tests", "Primality")
+	{
+		/* Miller-Rabin against trial division, and the numbers that fool weaker base sets */
+		static_assert(IsPrime(2) && IsPrime(97) && !IsPrime(1) && !IsPrime(1'681));
+		const auto isPrimeByDivision = [](std::uint64_t n)
+			{
+				if (n < 2) return false;
+				for (std::uint64_t d = 2; d * d <= n; ++d)
+				{
+					if (n % d == 0) return false;
+				}
+				return true;
+			};
+		for (std::uint64_t n = 0; n < 20'000; ++n)
+			CHECK_EQUAL(IsPrime(n), isPrimeByDivision(n));
+		for (std::uint64_t n = 1'000'000'000'000ULL; n < 1'000'000'000'200ULL; ++n)
+			CHECK_EQUAL(IsPrime(n), isPrimeByDivision(n));
+
+		// Carmichael numbers and strong pseudoprimes to the bases 2, 3, 5, 7, 11, ...
+		for (const std::uint64_t n : { 561ULL, 41'041ULL, 2'047ULL, 3'215'031'751ULL, 3'825'123'056'546'413'051ULL, 1'194'649ULL * 1'194'649ULL })
+			CHECK(!IsPrime(n));
+		CHECK(IsPrime(2'305'843'009'213'693'951ULL));                       // 2^61 - 1
+		CHECK(IsPrime(18'446'744'073'709'551'557ULL));                      // 2^64 - 59, the largest 64-bit prime
+		CHECK(!IsPrime(18'446'744'073'709'551'615ULL));
+		CHECK(!IsPrime(4'294'967'291ULL * 4'294'967'279ULL));              // product of the two largest 32-bit primes
+	}
+
+	TEST_CASE(ut_math_31, "Math Tests", "Prime Sieve")
+	{
+		/* segmented sieve against IsPrime across segment edges, on one thread and several (the wide windows are in ut_math_33) */
+		constexpr std::uint64_t segmentSpan = 2 * 8 * sieveSegmentBytes;
+		CHECK(SieveMatchesIsPrime(0, 100'000, 1));
+		CHECK(SieveMatchesIsPrime(segmentSpan - 5'000, segmentSpan + 5'000, 2));
+		CHECK(Primes(segmentSpan - 5'000, 3 * segmentSpan + 5'000, 4) == Primes(segmentSpan - 5'000, 3 * segmentSpan + 5'000, 1));
+		CHECK(SieveMatchesIsPrime(1'000'000'000'000ULL, 1'000'000'000'000ULL + 10'000, 3));
+		CHECK(SieveMatchesIsPrime(sieveLimit - 10'000, sieveLimit, 2));
+		for (const std::uint64_t hi : { 0, 1, 2, 3, 4, 5, 10 })
+			CHECK(SieveMatchesIsPrime(0, hi, 2));
+		CHECK(Primes(7, 8, 1) == std::vector<std::uint64_t>{ 7 });
+
+		// pi(10^7), the threads see the primes in increasing order
+		CHECK(CountPrimes(0, 10'000'000, 1) == 664'579);
+		CHECK(CountIncreasingPrimes(10'000'000, 3) == 664'579);
+
+		// a callback returning false stops the sieve: the first prime from 10^12 on
+		std::uint64_t first = 0;
+		ForEachPrime(1'000'000'000'000ULL, sieveLimit, [&first](std::uint64_t p) { first = p; return false; }, 4);
+		CHECK(first == 1'000'000'000'039ULL);
+	}
+
+	TEST_CASE(ut_math_32, "Math Tests", "Factorization")
+	{
+		/* Factorize against products of known primes: small ones, cofactors past the trial division table, powers and semiprimes */
+		using Factors = std::vector<std::pair<std::uint64_t, int>>;
+		CHECK(Factorize(0).empty());
+		CHECK(Factorize(1).empty());
+		CHECK((Factorize(2) == Factors{ { 2, 1 } }));
+		CHECK((Factorize(1ULL << 63) == Factors{ { 2, 63 } }));
+		CHECK((Factorize(18'446'744'073'709'551'615ULL) == Factors{ { 3, 1 }, { 5, 1 }, { 17, 1 }, { 257, 1 }, { 641, 1 }, { 65'537, 1 }, { 6'700'417, 1 } }));
+		CHECK((Factorize(18'446'744'073'709'551'557ULL) == Factors{ { 18'446'744'073'709'551'557ULL, 1 } }));
+		CHECK((Factorize(4'294'967'291ULL * 4'294'967'291ULL) == Factors{ { 4'294'967'291ULL, 2 } }));
+		CHECK((Factorize(2'097'143ULL * 2'097'143ULL * 2'097'143ULL) == Factors{ { 2'097'143ULL, 3 } }));
+		CHECK((Factorize(257ULL * 257 * 263) == Factors{ { 257, 2 }, { 263, 1 } }));
+		CHECK((Factorize(3'825'123'056'546'413'051ULL) == Factors{ { 149'491, 1 }, { 747'451, 1 }, { 34'233'211, 1 } }));
+
+		// semiprimes near 2^62 and random products, rebuilt from their factors
+		std::mt19937_64 engine(20261016);
+		const auto randomPrime = [&engine](std::uint64_t lo, std::uint64_t span)
+			{
+				std::uint64_t p = lo + engine() % span;
+				while (!IsPrime(p)) ++p;
+				return p;
+			};
+		for (int i = 0; i < 20; ++i)
+		{
+			const std::uint64_t p = randomPrime(2'000'000'000ULL, 147'000'000ULL), q = randomPrime(2'000'000'000ULL, 147'000'000ULL);
+			const Factors expected = p == q ? Factors{ { p, 2 } } : Factors{ { Min(p, q), 1 }, { Max(p, q), 1 } };
+			CHECK(Factorize(p * q) == expected);
+		}
+		for (int i = 0; i < 2'000; ++i)
+		{
+			const std::uint64_t n = engine() | 1;
+			std::uint64_t product = 1, previous = 0;
+			bool isValid = true;
+			for (const auto& [prime, multiplicity] : Factorize(n))
+			{
+				isValid = isValid && prime > previous && multiplicity > 0 && IsPrime(prime);
+				previous = prime;
+				for (int j = 0; j < multiplicity; ++j)
+					product *= prime;
+			}
+			CHECK(isValid && product == n);
+		}
+	}
+
+	TEST_CASE_STRESS(ut_math_33, 4, 1, "Math Tests", "Prime Sieve")
+	{
+		/* wide windows against IsPrime and pi(10^7), each thread sieving on its own worker count */
+		constexpr std::size_t workerCounts[] = { 1, 0, 2, 5 };
+		const std::size_t workerCount = workerCounts[threadIndex % 4];
+		constexpr std::uint64_t segmentSpan = 2 * 8 * sieveSegmentBytes;
+		CHECK(CountIncreasingPrimes(10'000'000, workerCount) == 664'579);
+		CHECK(SieveMatchesIsPrime(segmentSpan - 5'000, 3 * segmentSpan + 5'000, workerCount));
+		CHECK(SieveMatchesIsPrime(1'000'000'000'000ULL, 1'000'000'000'000ULL + 300'000, workerCount));
+		CHECK(SieveMatchesIsPrime(sieveLimit - 200'000, sieveLimit, workerCount));
+	}
+}; // end of namespace winxframe
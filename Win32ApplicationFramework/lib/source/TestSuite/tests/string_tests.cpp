@@ -1,7 +1,7 @@
 /*!
 lib\source\TestSuite\tests\string_tests.cpp
 Created: October 27, 2025
-Updated: November 2, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 String Tests source file.
@@ -37,4 +37,21 @@ namespace winxframe
 			CHECK(result == 0);
 		}
 	}
+
+	TEST_CASE(ut_string_02, "String Tests", "Glob Matching")
+	{
+		/* GlobMatch */
+		static_assert(string_utils::GlobMatch("", ""));
+		static_assert(string_utils::GlobMatch("*", ""));
+		static_assert(!string_utils::GlobMatch("?", ""));
+		CHECK(string_utils::GlobMatch("ut_math_01", "ut_math_01"));
+		CHECK(string_utils::GlobMatch("ut_math_*", "ut_math_17"));
+		CHECK(string_utils::GlobMatch("ut_*_0?", "ut_string_02"));
+		CHECK(string_utils::GlobMatch("*Tests", "Math Tests"));
+		CHECK(string_utils::GlobMatch("M*h*s", "Math Tests"));
+		CHECK(string_utils::GlobMatch("**a*", "banana"));
+		CHECK(!string_utils::GlobMatch("ut_math_?", "ut_math_17"));
+		CHECK(!string_utils::GlobMatch("*Tests", "Math Benchmarks"));
+		CHECK(!string_utils::GlobMatch("a*b", "acbx"));
+	}
 }; // end of namespace winxframe
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*!
+lib\source\TestSuite\tests\time_tests.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Time Tests source file.
+*/
+
+#include <TestSuite/test_macros.hpp>
+#include <utils/time_utils.hpp>
+
+namespace winxframe
+{
+	TEST_CASE(ut_time_01, "Time Tests", "Time Conversions")
+	{
+		using namespace std::chrono_literals;
+
+		time_utils::double_time converted = time_utils::ConvertToDouble(500ns);
+		CHECK(converted.time == 500.0 && converted.unit == "ns");
+
+		converted = time_utils::ConvertToDouble(1500ns);
+		CHECK(converted.time == 1.5 && converted.unit == "us");
+
+		converted = time_utils::ConvertToDouble(std::chrono::nanoseconds(2ms));
+		CHECK(converted.time == 2.0 && converted.unit == "ms");
+
+		converted = time_utils::ConvertToDouble(std::chrono::nanoseconds(30s));
+		CHECK(converted.time == 30.0 && converted.unit == "s");
+
+		converted = time_utils::ConvertToDouble(std::chrono::nanoseconds(90s));
+		CHECK(converted.time == 1.5 && converted.unit == "min");
+	}
+
+	TEST_CASE(ut_time_02, "Time Tests", "Allocation Guarantees")
+	{
+		using namespace std::chrono_literals;
+
+		// ConvertToDouble() runs every frame, its unit strings must stay within the small string buffer
+		double total = 0.0;
+		CHECK_NO_ALLOC(
+			for (std::chrono::nanoseconds elapsed = 1ns; elapsed < 1000s; elapsed *= 7)
+				total += time_utils::ConvertToDouble(elapsed).time;
+		);
+		CHECK(total > 0.0);
+
+		std::vector<int> values;
+		CHECK_MAX_ALLOCS(1,
+			values.reserve(64);
+			for (int i = 0; i < 64; ++i)
+				values.push_back(i);
+		);
+		CHECK_EQUAL(values.size(), std::size_t{ 64 });
+	}
+}; // end of namespace winxframe
@@ -0,0 +1,35 @@
+/*!
+lib\source\TestSuite\tests\window_tests.cpp
+Created: October 16, 2026
+Updated: October 16, 2026
+Copyright (c) 2025, Jacob Gosse
+
+Window Tests source file.
+*/
+
+#include <TestSuite/test_macros.hpp>
+#include <win32/Window/WindowCounter.hpp>
+
+namespace winxframe
+{
+	namespace
+	{
+		// exposes the protected counter updates that windows make on creation and destruction
+		class WindowCounterProbe : public WindowCounter
+		{
+		public:
+			using WindowCounter::IncrementWindowCount;
+			using WindowCounter::DecrementWindowCount;
+		};
+	}
+
+	TEST_CASE_STRESS(ut_window_01, 8, 20000, "Window Tests", "Window Counter")
+	{
+		static WindowCounterProbe probe;
+		const MessagePumpMode mode = threadIndex % 2 == 0 ? MessagePumpMode::RealTime : MessagePumpMode::EventDriven;
+
+		probe.IncrementWindowCount(mode);
+		CHECK(mode == MessagePumpMode::RealTime ? WindowCounter::HasRealTimeWindow() : WindowCounter::HasEventDrivenWindow());
+		probe.DecrementWindowCount(mode);
+	}
+}; // end of namespace winxframe
@@ -1,7 +1,7 @@
 /*!
 lib\source\win32\win32_platform.cpp
 Created: October 5, 2025
-Updated: November 29, 2025
+Updated: October 16, 2026
 Copyright (c) 2025, Jacob Gosse
 
 Win32 Platform source file.
@@ -94,13 +94,25 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
     // windows vector
     std::vector<std::unique_ptr<Window>> windows;
 
+    // unit test (and benchmark regression) result, returned as the process exit code
+    int testResult = EXIT_SUCCESS;
+
     try
     {
+        // unit test options
+        winxframe::TestOptions testOptions;
+        testOptions.ApplyEnvironment();
+        testOptions.ApplyCommandLine();
+
+        // an isolated test case child process runs its case and exits without a console or windows
+        if (testOptions.IsChildProcess())
+            return winxframe::TestRegistry::RunAll(testOptions);
+
         // init console
         console = std::make_unique<winxframe::Console>(hInstance, L"CONSOLE", consoleSize.X, consoleSize.Y);
 
         // run unit tests
-        winxframe::TestRegistry::RunAll();
+        testResult = winxframe::TestRegistry::RunAll(testOptions);
 
         // create the WNDCLASSEX registry
         WindowClassRegistry windowClassRegistry;
@@ -198,5 +210,5 @@ int APIENTRY wWinMain(_In_ HINSTANCE hInstance, _In_opt_ HINSTANCE hPrevInstance
     console.reset();
     console = nullptr;
 
-    return 0;
+    return testResult;
 }
\ No newline at end of file